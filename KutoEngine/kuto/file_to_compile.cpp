@@ -4,6 +4,7 @@
 #include "kuto_debug_menu.cpp"
 #include "kuto_graphics2d.cpp"
 #include "kuto_graphics_device.cpp"
+#include "kuto_indexed_image.cpp"
 #include "kuto_irender.cpp"
 #include "kuto_key_pad.cpp"
 #include "kuto_layer.cpp"
@@ -17,8 +18,11 @@
 #include "kuto_memory.cpp"
 #include "kuto_performance_info.cpp"
 #include "kuto_png_loader.cpp"
+#include "kuto_random.cpp"
+#include "kuto_render_backend.cpp"
 #include "kuto_render_manager.cpp"
 #include "kuto_section_manager.cpp"
+#include "kuto_software_render_backend.cpp"
 #include "kuto_task.cpp"
 #include "kuto_texture.cpp"
 #include "kuto_timer.cpp"
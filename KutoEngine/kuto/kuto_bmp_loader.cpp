@@ -1,4 +1,5 @@
 #include "kuto_bmp_loader.h"
+#include "kuto_indexed_image.h"
 #include "kuto_load_texture_core.h"
 #include "kuto_error.h"
 #include "kuto_utility.h"
@@ -10,7 +11,7 @@
 
 namespace kuto {
 
-bool BmpLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaPalette, int hue)
+bool BmpLoader::readHeader(char* bytes, ImageInfo& image)
 {
 	if(!bytes) return false;
 // read header
@@ -20,8 +21,6 @@ bool BmpLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
 		memcmp(header.signature, this->signature(), SIGNATURE_SIZE) != 0
 	) return false;
 
-	uint width, height, bpp;
-	u8* paletteStart;
 	CompressType compType;
 	u8* offset = reinterpret_cast< u8* >( bytes + sizeof(FileHeader) );
 	switch( *( reinterpret_cast< u32* >( offset ) ) ) {
@@ -29,11 +28,12 @@ bool BmpLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
 		case 12: {
 			CoreHeader core;
 			memccpy( &core, offset, sizeof(CoreHeader) );
-			width = core.width;
-			height = core.height;
-			bpp = core.bitsPerPixel;
+			image.width = core.width;
+			image.height = core.height;
+			image.bpp = core.bitsPerPixel;
+			image.colorNum = 0;
 			compType = BI_RGB;
-			paletteStart = offset + core.headerSize;
+			image.palette = offset + core.headerSize;
 		} break;
  */
 		case 40:
@@ -42,15 +42,60 @@ bool BmpLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
 		case 124: {
 			InfoHeader info;
 			memcpy( &info, offset, sizeof(InfoHeader) );
-			width = info.width;
-			height = info.height;
-			bpp = info.bitsPerPixel;
+			image.width = info.width;
+			image.height = info.height;
+			image.bpp = info.bitsPerPixel;
 			compType = (CompressType) info.compressType;
-			paletteStart = offset + info.headerSize;
+			image.colorNum = info.usingColorNum;
+			image.palette = offset + info.headerSize;
 		} break;
 		default: return false;
 	}
 
+	switch(compType) {
+		case BI_RGB: break;
+		default: return false;
+	}
+
+	if( image.colorNum == 0 && image.bpp <= 8 ) image.colorNum = 1 << image.bpp;
+	image.pixels = reinterpret_cast< u8* >(bytes + header.offset);
+	return true;
+}
+
+bool BmpLoader::decodeIndexed(char* bytes, IndexedImage& image)
+{
+	ImageInfo info;
+	if( !readHeader(bytes, info) || (info.bpp != 8) ) return false;
+
+// set palette
+	RgbQuad* palette = reinterpret_cast< RgbQuad* >(info.palette);
+	std::memset(image.palette, 0, sizeof(image.palette));
+	for (uint i = 0; i < info.colorNum && i < uint(IndexedImage::COLOR_NUM); i++) {
+		image.palette[i].red   = palette[i].red;
+		image.palette[i].green = palette[i].green;
+		image.palette[i].blue  = palette[i].blue;
+	}
+// rows are stored bottom up
+	uint align = (info.width%LINE_ALIGN == 0) ? info.width : ( (info.width/LINE_ALIGN + 1) * LINE_ALIGN );
+	image.width  = info.width;
+	image.height = info.height;
+	image.pixels.resize(info.width * info.height);
+	for (uint row = 0; row < info.height; row++) {
+		memcpy(
+			&image.pixels[(info.height - row - 1) * info.width],
+			info.pixels + row * align,
+			info.width
+		);
+	}
+	return true;
+}
+
+bool BmpLoader::createTexture(char* bytes, LoadTextureCore& core)
+{
+	ImageInfo info;
+	if( !readHeader(bytes, info) ) return false;
+
+	uint width = info.width, height = info.height;
 	GLenum format;
 	int texDepth;
 	int texWidth  = fixPowerOfTwo(width);
@@ -58,44 +103,11 @@ bool BmpLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
 	int texByteSize;
 	u8* imageData;
 
-	switch(compType) {
-		case BI_RGB: break;
-		default: return false;
-	}
-
-	offset = reinterpret_cast< u8* >(bytes + header.offset);
-	switch(bpp) {
-		case 8: {
-		// set palette
-			RgbQuad* palette = reinterpret_cast< RgbQuad* >(paletteStart);
-		// set parameter for GL
-			format = useAlphaPalette ? GL_RGBA : GL_RGB;
-			texDepth  = useAlphaPalette ? 32 : 24;
-			texByteSize = texDepth / CHAR_BIT;
-			imageData = new u8[texWidth * texHeight * texByteSize];
-			memset(imageData, 0, texWidth * texHeight * texByteSize);
-		// convert to texture format
-			uint align = (width%LINE_ALIGN == 0) ? width : ( (width/LINE_ALIGN + 1) * LINE_ALIGN );
-
-			for (uint row = 0; row < height; row++) {
-				u8* dst = imageData + (height - row - 1) * texWidth * texByteSize;
-				u8* src = offset + row * align;
-				for (uint i = 0; i < width; i++) {
-					RgbQuad const& color = palette[*src];
-					dst[0] = color.red;
-					dst[1] = color.green;
-					dst[2] = color.blue;
-					if (useAlphaPalette)
-						dst[3] = (*src == 0)? 0x00 : 0xff;
-
-					src++;
-					dst += texByteSize;
-				}
-			}
-		} break;
+	u8* offset = info.pixels;
+	switch(info.bpp) {
 		case 24: {
 			format = GL_RGB;
-			texDepth  = bpp;
+			texDepth  = info.bpp;
 			texByteSize = texDepth / CHAR_BIT;
 			imageData = new u8[texWidth * texHeight * texByteSize];
 
@@ -111,7 +123,7 @@ bool BmpLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
 		} break;
 		case 32: {
 			format = GL_RGBA;
-			texDepth  = bpp;
+			texDepth  = info.bpp;
 			texByteSize = texDepth / CHAR_BIT;
 			imageData = new u8[texWidth * texHeight * texByteSize];
 
@@ -125,7 +137,7 @@ bool BmpLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
 				);
 			}
 		} break;
-		default: return false;
+		default: return false;	// paletted images go through decodeIndexed()
 	}
 // create texture
 	bool ret = core.createTexture(
@@ -12,11 +12,15 @@
 namespace kuto {
 
 class LoadTextureCore;
+struct IndexedImage;
 
 class BmpLoader
 {
 public:
-	bool createTexture(char* bytes, LoadTextureCore& core, bool useAlphaPalette, int hue);
+	/// 8 bit images. false for the others
+	bool decodeIndexed(char* bytes, IndexedImage& image);
+	/// 24 / 32 bit images
+	bool createTexture(char* bytes, LoadTextureCore& core);
 
 protected:
 	virtual const char* signature() { return "BM"; }
@@ -67,6 +71,16 @@ private:
 	};
 #pragma pack(pop)
 
+	struct ImageInfo
+	{
+		uint width, height;
+		uint bpp;
+		uint colorNum;		///< palette entries
+		u8* palette;
+		u8* pixels;
+	};
+	bool readHeader(char* bytes, ImageInfo& image);
+
 	enum CompressType
 	{
 		BI_RGB = 0,
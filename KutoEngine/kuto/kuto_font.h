@@ -36,6 +36,8 @@ public:
 	void drawText(const char* str, const Vector2& pos, const Color& color, float size, Font::Type type);
 	void drawText(const char* str, const Vector2& pos, Texture& tex, uint const color, Font::Type type, float const size);
 	kuto::Vector2 textSize(const char* str, float size, Font::Type type);
+	/// rasterizes the glyphs of str into the atlas ahead of drawing
+	void prewarm(const char* str, Font::Type type = NORMAL);
 };
 
 }	// namespace kuto
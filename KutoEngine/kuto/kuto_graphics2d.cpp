@@ -26,24 +26,107 @@ namespace
 		0.5f,  0.5f, // RightTop
 		0.5f, -0.5f, // RightBottom
 	};
+	// triangle strip order -> triangle list order
+	const int quadIndices[] = { 0, 1, 2, 2, 1, 3, };
 
-	static GLfloat uvArray[8];
+	const std::size_t BATCH_QUAD_RESERVE = 512;
+
+	void setUV(GLfloat (&uv)[8], const kuto::Texture& texture
+	, const kuto::Vector2& texcoord0, const kuto::Vector2& texcoord1, bool fixTexCoord)
+	{
+		uv[0] = texcoord0.x;	uv[1] = texcoord0.y;
+		uv[2] = texcoord0.x;	uv[3] = texcoord1.y;
+		uv[4] = texcoord1.x;	uv[5] = texcoord0.y;
+		uv[6] = texcoord1.x;	uv[7] = texcoord1.y;
+		if (fixTexCoord && texture.isValid()) {
+			float widthScale = (float)texture.orgWidth() / texture.width();
+			float heightScale = (float)texture.orgHeight() / texture.height();
+			for (int i = 0; i < 8; i += 2) {
+				uv[i + 0] *= widthScale;
+				uv[i + 1] *= heightScale;
+			}
+		}
+	}
+	// same as (vertex * scaling(size.x, -size.y) * translation(pos))
+	void setPanelPosition(kuto::Vector2 (&dst)[4], const kuto::Vector2& pos, const kuto::Vector2& size)
+	{
+		for (int i = 0; i < 4; i++) {
+			dst[i].x = pos.x + panelVertices[i * 2 + 0] * size.x;
+			dst[i].y = pos.y - panelVertices[i * 2 + 1] * size.y;
+		}
+	}
+
+	const GLfloat noUV[8] = { 0.f, };
 }
 
 namespace kuto {
 
 Graphics2D::Graphics2D(GraphicsDevice& dev)
 : device_(dev)
+, batchTexture2D_(false), batchTexture_(0)
+, batchSrcFactor_(GL_SRC_ALPHA), batchDestFactor_(GL_ONE_MINUS_SRC_ALPHA)
+, batchColor_(1.f, 1.f, 1.f, 1.f)
+{
+	batchVertices_.reserve(BATCH_QUAD_RESERVE * 6);
+}
+
+void Graphics2D::addQuad(bool texture2D, GLuint texture, GLenum srcFactor, GLenum destFactor,
+					const Color& color, const Vector2 (&pos)[4], const GLfloat (&uv)[8])
+{
+	if (!batchVertices_.empty() && (
+		batchTexture2D_ != texture2D || (texture2D && batchTexture_ != texture) ||
+		batchSrcFactor_ != srcFactor || batchDestFactor_ != destFactor || batchColor_ != color)
+	) {
+		flush();
+	}
+	batchTexture2D_ = texture2D;
+	batchTexture_ = texture;
+	batchSrcFactor_ = srcFactor;
+	batchDestFactor_ = destFactor;
+	batchColor_ = color;
+
+	for (int i = 0; i < 6; i++) {
+		int const index = quadIndices[i];
+		Vertex2DPosUV v;
+		v.position = pos[index];
+		v.uv.set(uv[index * 2 + 0], uv[index * 2 + 1]);
+		batchVertices_.push_back(v);
+	}
+}
+
+void Graphics2D::flush()
 {
+	if (batchVertices_.empty()) return;
+
+	GLsizei const stride = sizeof(Vertex2DPosUV);
+	device_.setVertexPointer(2, GL_FLOAT, stride, &batchVertices_[0].position);
+	if (batchTexture2D_) {
+		device_.setTexCoordPointer(2, GL_FLOAT, stride, &batchVertices_[0].uv);
+		device_.setVertexState(true, false, true, false);
+		device_.setTexture2D(true, batchTexture_);
+	} else {
+		device_.setVertexState(true, false, false, false);
+		device_.setTexture2D(false, 0);
+	}
+	device_.setBlendState(true, batchSrcFactor_, batchDestFactor_);
+	device_.setColor(batchColor_);
+	Matrix m;
+	m.identity();
+	device_.setModelMatrix(m);
+	device_.drawArrays(GL_TRIANGLES, 0, batchVertices_.size());
+
+	batchVertices_.clear();
 }
 
 void Graphics2D::drawText(const char* str, const Vector2& pos, const Color& color, float fontSize,
 		Font::Type fontType)
 {
+	flush();
 	Font::instance().drawText(str, pos, color, fontSize, fontType);
 }
 void Graphics2D::drawText(const char* str, const Vector2& pos, Texture& tex, uint const color, Font::Type type, float const size)
 {
+	flush();
 	Font::instance().drawText(str, pos, tex, color, type, size);
 }
 
@@ -57,31 +140,11 @@ void Graphics2D::drawTexture(const Texture& texture, const Vector2& pos, const V
 void Graphics2D::drawTexture(const Texture& texture, const Vector2& pos, const Vector2& size, const Color& color,
 					const Vector2& texcoord0, const Vector2& texcoord1, bool fixTexCoord)
 {
-	uvArray[0] = texcoord0.x;	uvArray[1] = texcoord0.y;
-	uvArray[2] = texcoord0.x;	uvArray[3] = texcoord1.y;
-	uvArray[4] = texcoord1.x;	uvArray[5] = texcoord0.y;
-	uvArray[6] = texcoord1.x;	uvArray[7] = texcoord1.y;
-	if (fixTexCoord && texture.isValid()) {
-		float widthScale = (float)texture.orgWidth() / texture.width();
-		float heightScale = (float)texture.orgHeight() / texture.height();
-		uvArray[0] *= widthScale;	uvArray[1] *= heightScale;
-		uvArray[2] *= widthScale;	uvArray[3] *= heightScale;
-		uvArray[4] *= widthScale;	uvArray[5] *= heightScale;
-		uvArray[6] *= widthScale;	uvArray[7] *= heightScale;
-	}
-
-	device_.setVertexPointer(2, GL_FLOAT, 0, panelVertices);
-	device_.setTexCoordPointer(2, GL_FLOAT, 0, uvArray);
-	device_.setVertexState(true, false, true, false);
-	device_.setTexture2D(true, texture.glTexture());
-	device_.setBlendState(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-	device_.setColor(color);
-	Matrix mt, ms;
-	mt.translation(Vector3(pos.x, pos.y, 0.f));
-	ms.scaling(Vector3(size.x, -size.y, 1.f));
-	Matrix m = ms * mt;
-	device_.setModelMatrix(m);
-	device_.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	GLfloat uv[8];
+	setUV(uv, texture, texcoord0, texcoord1, fixTexCoord);
+	Vector2 quad[4];
+	setPanelPosition(quad, pos, size);
+	addQuad(true, texture.glTexture(), GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, color, quad, uv);
 }
 
 void Graphics2D::drawTextureRotate(const Texture& texture, const Vector2& center, const Vector2& size, const Color& color,
@@ -93,32 +156,19 @@ void Graphics2D::drawTextureRotate(const Texture& texture, const Vector2& center
 void Graphics2D::drawTextureRotate(const Texture& texture, const Vector2& center, const Vector2& size, const Color& color,
 					float angle, const Vector2& texcoord0, const Vector2& texcoord1, bool fixTexCoord)
 {
-	uvArray[0] = texcoord0.x;	uvArray[1] = texcoord0.y;
-	uvArray[2] = texcoord0.x;	uvArray[3] = texcoord1.y;
-	uvArray[4] = texcoord1.x;	uvArray[5] = texcoord0.y;
-	uvArray[6] = texcoord1.x;	uvArray[7] = texcoord1.y;
-	if (fixTexCoord && texture.isValid()) {
-		float widthScale = (float)texture.orgWidth() / texture.width();
-		float heightScale = (float)texture.orgHeight() / texture.height();
-		uvArray[0] *= widthScale;	uvArray[1] = (uvArray[1]) * heightScale;
-		uvArray[2] *= widthScale;	uvArray[3] = (uvArray[3]) * heightScale;
-		uvArray[4] *= widthScale;	uvArray[5] = (uvArray[5]) * heightScale;
-		uvArray[6] *= widthScale;	uvArray[7] = (uvArray[7]) * heightScale;
+	GLfloat uv[8];
+	setUV(uv, texture, texcoord0, texcoord1, fixTexCoord);
+	// same as (vertex * scaling(size.x, -size.y) * rotationZ(angle) * translation(center))
+	float const cosZ = std::cos(angle);
+	float const sinZ = std::sin(angle);
+	Vector2 quad[4];
+	for (int i = 0; i < 4; i++) {
+		float const x =  rotVertices[i * 2 + 0] * size.x;
+		float const y = -rotVertices[i * 2 + 1] * size.y;
+		quad[i].x = center.x + x * cosZ - y * sinZ;
+		quad[i].y = center.y + x * sinZ + y * cosZ;
 	}
-
-	device_.setVertexPointer(2, GL_FLOAT, 0, rotVertices);
-	device_.setTexCoordPointer(2, GL_FLOAT, 0, uvArray);
-	device_.setVertexState(true, false, true, false);
-	device_.setTexture2D(true, texture.glTexture());
-	device_.setBlendState(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-	device_.setColor(color);
-	Matrix mt, ms, mr;
-	mt.translation(Vector3(center.x, center.y, 0.f));
-	mr.rotationZ(angle);
-	ms.scaling(Vector3(size.x, -size.y, 1.f));
-	Matrix m = ms * mr * mt;
-	device_.setModelMatrix(m);
-	device_.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	addQuad(true, texture.glTexture(), GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, color, quad, uv);
 }
 
 void Graphics2D::drawTexture9Grid(const Texture& texture, const Vector2& pos, const Vector2& size, const Color& color,
@@ -162,31 +212,14 @@ void Graphics2D::drawTexture9Grid(const Texture& texture, const Vector2& pos, co
 
 void Graphics2D::drawRectangle(const Vector2& pos, const Vector2& size, const Color& color)
 {
-	device_.setVertexPointer(2, GL_FLOAT, 0, panelVertices);
-	device_.setVertexState(true, false, false, false);
-	device_.setBlendState(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-	device_.setColor(color);
-	Matrix mt, ms;
-	mt.translation(Vector3(pos.x, pos.y, 0.f));
-	ms.scaling(Vector3(size.x, -size.y, 1.f));
-	Matrix m = ms * mt;
-	device_.setModelMatrix(m);
-	device_.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	fillRectangle(pos, size, color);
 }
 
 void Graphics2D::fillRectangle(const Vector2& pos, const Vector2& size, const Color& color)
 {
-	device_.setTexture2D(false, 0);
-	device_.setVertexPointer(2, GL_FLOAT, 0, panelVertices);
-	device_.setVertexState(true, false, false, false);
-	device_.setBlendState(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-	device_.setColor(color);
-	Matrix mt, ms;
-	mt.translation(Vector3(pos.x, pos.y, 0.f));
-	ms.scaling(Vector3(size.x, -size.y, 1.f));
-	Matrix m = ms * mt;
-	device_.setModelMatrix(m);
-	device_.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	Vector2 quad[4];
+	setPanelPosition(quad, pos, size);
+	addQuad(false, 0, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, color, quad, noUV);
 }
 
 void Graphics2D::fillRectangleMask(const Vector2& pos, const Vector2& size, const Color& color, const Texture& texture, bool fixTexCoord)
@@ -197,49 +230,25 @@ void Graphics2D::fillRectangleMask(const Vector2& pos, const Vector2& size, cons
 void Graphics2D::fillRectangleMask(const Vector2& pos, const Vector2& size, const Color& color, const Texture& texture,
 					const Vector2& texcoord0, const Vector2& texcoord1, bool fixTexCoord)
 {
-	uvArray[0] = texcoord0.x;	uvArray[1] = texcoord0.y;
-	uvArray[2] = texcoord0.x;	uvArray[3] = texcoord1.y;
-	uvArray[4] = texcoord1.x;	uvArray[5] = texcoord0.y;
-	uvArray[6] = texcoord1.x;	uvArray[7] = texcoord1.y;
-	if (fixTexCoord && texture.isValid()) {
-		float widthScale = (float)texture.orgWidth() / texture.width();
-		float heightScale = (float)texture.orgHeight() / texture.height();
-		uvArray[0] *= widthScale;	uvArray[1] = (uvArray[1]) * heightScale;
-		uvArray[2] *= widthScale;	uvArray[3] = (uvArray[3]) * heightScale;
-		uvArray[4] *= widthScale;	uvArray[5] = (uvArray[5]) * heightScale;
-		uvArray[6] *= widthScale;	uvArray[7] = (uvArray[7]) * heightScale;
-	}
-
-	device_.setTexture2D(true, texture.glTexture());
-	device_.setVertexPointer(2, GL_FLOAT, 0, panelVertices);
-	device_.setTexCoordPointer(2, GL_FLOAT, 0, uvArray);
-	device_.setVertexState(true, false, true, false);
-	device_.setColor(color);
-	Matrix mt, ms;
-	mt.translation(Vector3(pos.x, pos.y, 0.f));
-	ms.scaling(Vector3(size.x, -size.y, 1.f));
-	Matrix m = ms * mt;
-	device_.setModelMatrix(m);
-
-	device_.setBlendState(true, GL_ZERO, GL_ONE_MINUS_SRC_ALPHA);
-	device_.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	GLfloat uv[8];
+	setUV(uv, texture, texcoord0, texcoord1, fixTexCoord);
+	Vector2 quad[4];
+	setPanelPosition(quad, pos, size);
 
-	device_.setTexture2D(false, 0);
-	device_.setVertexState(true, false, false, false);
-	device_.setBlendState(true, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
-	device_.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	addQuad(true, texture.glTexture(), GL_ZERO, GL_ONE_MINUS_SRC_ALPHA, color, quad, uv);
+	addQuad(false, 0, GL_ONE_MINUS_DST_ALPHA, GL_ONE, color, quad, noUV);
 }
 
 }	// namespace kuto
 
-bool RPG2kUtil::LoadImage(kuto::Texture& texture, const std::string& filename, bool useAlphaPalette, int hue)
+bool RPG2kUtil::LoadImage(kuto::Texture& texture, const std::string& filename, bool useAlphaPalette, int hue, bool async)
 {
 	static char const* EXT[] = { ".png", ".bmp", ".xyz", };
 // search current directory
 	for(uint i = 0; i < sizeof(EXT) / sizeof(EXT[0]); i++) {
 		std::string temp = filename + EXT[i];
 		if (kuto::File::exists(temp.c_str())) {
-			texture.loadFromFile(temp.c_str(), useAlphaPalette, hue);
+			texture.loadFromFile(temp.c_str(), useAlphaPalette, hue, async);
 			return true;
 		}
 	}
@@ -256,7 +265,7 @@ bool RPG2kUtil::LoadImage(kuto::Texture& texture, const std::string& filename, b
 	for(uint i = 0; i < sizeof(EXT) / sizeof(EXT[0]); i++) {
 		std::string temp = rtpPath + EXT[i];
 		if (kuto::File::exists(temp.c_str())) {
-			texture.loadFromFile(temp.c_str(), useAlphaPalette, hue);
+			texture.loadFromFile(temp.c_str(), useAlphaPalette, hue, async);
 			return true;
 		}
 	}
@@ -8,6 +8,9 @@
 #include "kuto_math.h"
 #include "kuto_font.h"
 #include "kuto_texture.h"
+#include "kuto_vertex.h"
+
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -47,13 +50,26 @@ public:
 	, const Color& color, const Texture& texture
 	, const Vector2& texcoord0, const Vector2& texcoord1, bool fixTexCoord = false);
 
+	/// draw queued quads. must be called before touching GraphicsDevice directly
+	void flush();
+
+private:
+	void addQuad(bool texture2D, GLuint texture, GLenum srcFactor, GLenum destFactor
+	, const Color& color, const Vector2 (&pos)[4], const GLfloat (&uv)[8]);
+
 private:
 	GraphicsDevice& device_;
+	std::vector<Vertex2DPosUV>	batchVertices_;		///< quads queued for the current state (as triangles)
+	bool						batchTexture2D_;
+	GLuint						batchTexture_;
+	GLenum						batchSrcFactor_;
+	GLenum						batchDestFactor_;
+	Color						batchColor_;
 };
 
 }	// namespace kuto
 
 namespace RPG2kUtil
 {
-	bool LoadImage(kuto::Texture& texture, const std::string& filename, bool useAlphaPalette, int hue = 0);
+	bool LoadImage(kuto::Texture& texture, const std::string& filename, bool useAlphaPalette, int hue = 0, bool async = false);
 } // namespace CRpgUtil
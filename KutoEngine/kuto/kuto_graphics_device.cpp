@@ -12,7 +12,8 @@ namespace kuto {
 
 GraphicsDevice::GraphicsDevice()
 // : viewRenderbuffer_(NULL), viewFramebuffer_(NULL), depthRenderbuffer_(NULL)
-: viewRenderbuffer_(0), viewFramebuffer_(0), depthRenderbuffer_(0)
+: backend_(&glBackend_)
+, viewRenderbuffer_(0), viewFramebuffer_(0), depthRenderbuffer_(0)
 , width_(0), height_(0)
 {
 }
@@ -80,23 +81,23 @@ void GraphicsDevice::setProjectionMatrix(const Matrix& matrix)
 {
 	if (matrixMode_ != GL_PROJECTION) {
 		matrixMode_ = GL_PROJECTION;
-		glMatrixMode(matrixMode_);
+		backend_->setMatrixMode(matrixMode_);
 	}
-	glLoadMatrixf(matrix.pointer());
+	backend_->loadMatrix(matrix);
 }
 
 void GraphicsDevice::setModelMatrix(const Matrix& matrix)
 {
 	if (matrixMode_ != GL_MODELVIEW) {
 		matrixMode_ = GL_MODELVIEW;
-		glMatrixMode(matrixMode_);
+		backend_->setMatrixMode(matrixMode_);
 	}
-	glLoadMatrixf(matrix.pointer());
+	backend_->loadMatrix(matrix);
 }
 
 void GraphicsDevice::setViewport(const Viewport& viewport)
 {
-    glViewport(viewport.x, viewport.y, viewport.width, viewport.height);
+	backend_->setViewport(viewport);
 }
 
 void GraphicsDevice::setVertexState(bool enableVertex, bool enableNormal, bool enableTexcoord, bool enableColor)
@@ -128,7 +129,7 @@ void GraphicsDevice::setBlendState(bool enableBlend, GLenum srcFactor, GLenum de
 	if (blendSrcFactor_ != srcFactor || blendDestFactor_ != destFactor) {
 		blendSrcFactor_ = srcFactor;
 		blendDestFactor_ = destFactor;
-		glBlendFunc(blendSrcFactor_, blendDestFactor_);
+		backend_->setBlendFunc(blendSrcFactor_, blendDestFactor_);
 	}
 }
 
@@ -140,7 +141,7 @@ void GraphicsDevice::setTexture2D(bool enable, GLuint texture)
 	}
 	if (bindTexture2D_ != texture) {
 		bindTexture2D_ = texture;
-		glBindTexture(GL_TEXTURE_2D, bindTexture2D_);
+		backend_->bindTexture(bindTexture2D_);
 	}
 }
 
@@ -148,7 +149,7 @@ void GraphicsDevice::setColor(const Color& color)
 {
 	if (color_ != color) {
 		color_ = color;
-		glColor4f(color_.r, color_.g, color_.b, color_.a);
+		backend_->setColor(color_);
 	}
 }
 
@@ -156,7 +157,7 @@ void GraphicsDevice::setVertexPointer(GLint size, GLenum type, GLsizei stride, c
 {
 	if (!vertexPointerInfo_.equals(size, type, stride, pointer)) {
 		vertexPointerInfo_.set(size, type, stride, pointer);
-		glVertexPointer(size, type, stride, pointer);
+		backend_->setPointer(GL_VERTEX_ARRAY, size, type, stride, pointer);
 	}
 }
 
@@ -164,7 +165,7 @@ void GraphicsDevice::setTexCoordPointer(GLint size, GLenum type, GLsizei stride,
 {
 	if (!texcoordPointerInfo_.equals(size, type, stride, pointer)) {
 		texcoordPointerInfo_.set(size, type, stride, pointer);
-		glTexCoordPointer(size, type, stride, pointer);
+		backend_->setPointer(GL_TEXTURE_COORD_ARRAY, size, type, stride, pointer);
 	}
 }
 
@@ -172,12 +173,54 @@ void GraphicsDevice::setColorPointer(GLint size, GLenum type, GLsizei stride, co
 {
 	if (!colorPointerInfo_.equals(size, type, stride, pointer)) {
 		colorPointerInfo_.set(size, type, stride, pointer);
-		glColorPointer(size, type, stride, pointer);
+		backend_->setPointer(GL_COLOR_ARRAY, size, type, stride, pointer);
 	}
 }
 
+/**
+ * テクスチャ作成
+ * @param width			幅
+ * @param height		高さ
+ * @param format		GLフォーマット
+ * @param type			ピクセルタイプ
+ * @param data			ピクセル（NULLなら未初期化）
+ * @param wrap			GL_CLAMP_TO_EDGE / GL_REPEAT
+ * @return				テクスチャ名（バインドされたまま）
+ */
+GLuint GraphicsDevice::createTexture(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data, GLenum wrap)
+{
+	bindTexture2D_ = backend_->createTexture(width, height, format, type, data, wrap);
+	return bindTexture2D_;
+}
+
+void GraphicsDevice::updateTexture(GLuint texture, GLint x, GLint y, GLsizei width, GLsizei height
+, GLenum format, GLenum type, const GLvoid* data)
+{
+	backend_->updateTexture(texture, x, y, width, height, format, type, data);
+	bindTexture2D_ = texture;
+}
+
+void GraphicsDevice::deleteTexture(GLuint texture)
+{
+	backend_->deleteTexture(texture);
+	if (bindTexture2D_ == texture)
+		bindTexture2D_ = 0;		// GL falls back to the default texture
+}
+
+/**
+ * 描画バックエンド切り替え
+ * 次のbeginRenderでステートが送り直される
+ * @param backend		バックエンド（NULLならGL）
+ */
+void GraphicsDevice::setBackend(RenderBackend* backend)
+{
+	backend_ = backend? backend : &glBackend_;
+}
+
 void GraphicsDevice::syncState()
 {
+	if (!backend_->directGL())
+		return;		// the cache is the only state there is
 #if !RPG2K_IS_PSP // some functions are not implemented in PSPGL
 	GLboolean b;
 	glGetBooleanv(GL_VERTEX_ARRAY, &b); enableVertex_ = (b != GL_FALSE);
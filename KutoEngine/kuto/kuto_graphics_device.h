@@ -8,11 +8,18 @@
 #include "kuto_math.h"
 #include "kuto_error.h"
 #include "kuto_gl.h"
+#include "kuto_render_backend.h"
 #include "kuto_singleton.h"
 
+#if !RPG2K_IS_IPHONE
+	#include <boost/scoped_ptr.hpp>
+#endif
+
 
 namespace kuto {
 
+class SoftwareRenderBackend;
+
 class GraphicsDevice : public Singleton<GraphicsDevice>
 {
 	friend class Singleton<GraphicsDevice>;
@@ -27,6 +34,12 @@ public:
 #else // using GLUT
 	typedef void (*UpdateFunc)(float);
 	bool initialize(int& argc, char *argv[], int w, int h, const char *title, UpdateFunc func);
+	/// draws with SoftwareRenderBackend instead of opening a window
+	bool initializeHeadless(int w, int h, UpdateFunc func);
+	/// runs frameNum frames without waiting. frames are saved as PNG into dumpDirectory unless it is NULL.
+	/// returns false when a frame couldn't be saved
+	bool runHeadless(int frameNum, const char* dumpDirectory);
+	SoftwareRenderBackend* softwareBackend() { return softwareBackend_.get(); }
 	void callbackGultDisplay();
 
 	UpdateFunc		updateFunc_;
@@ -40,17 +53,17 @@ public:
 	void beginRender();
 	void endRender();
 
+	/// GLRenderBackend unless replaced. not owned
+	void setBackend(RenderBackend* backend);
+	RenderBackend& backend() { return *backend_; }
+	/// false when raw GL calls don't reach the screen
+	bool directGL() const { return backend_->directGL(); }
+
 	void setGLClientState(GLenum state, bool enable) const {
-		if (enable)
-			glEnableClientState(state);
-		else
-			glDisableClientState(state);
+		backend_->setClientState(state, enable);
 	}
 	void setGLEnable(GLenum state, bool enable) const {
-		if (enable)
-			glEnable(state);
-		else
-			glDisable(state);
+		backend_->setEnable(state, enable);
 	}
 	void setVertexState(bool enableVertex, bool enableNormal, bool enableTexcoord, bool enableColor);
 	void setBlendState(bool enableBlend, GLenum srcFactor, GLenum destFactor);
@@ -60,9 +73,15 @@ public:
 	void setTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
 	void setColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
 	void drawArrays(GLenum mode, GLint first, GLsizei count) {
-		glDrawArrays(mode, first, count);
+		backend_->drawArrays(mode, first, count);
 	}
 
+	/// the created / updated texture is left bound
+	GLuint createTexture(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data, GLenum wrap = GL_CLAMP_TO_EDGE);
+	void updateTexture(GLuint texture, GLint x, GLint y, GLsizei width, GLsizei height
+	, GLenum format, GLenum type, const GLvoid* data);
+	void deleteTexture(GLuint texture);
+
 	void setTitle(std::string const& title);
 
 	void syncState();
@@ -87,6 +106,11 @@ private:
 	};	// struct VertexPointerInfo
 
 private:
+	GLRenderBackend					glBackend_;
+	RenderBackend*					backend_;
+#if !RPG2K_IS_IPHONE
+	boost::scoped_ptr<SoftwareRenderBackend>	softwareBackend_;
+#endif
 	GLuint 							viewRenderbuffer_;
 	GLuint							viewFramebuffer_;
 	GLuint							depthRenderbuffer_;
@@ -0,0 +1,96 @@
+/**
+ * @file
+ * @brief Indexed Image Cache
+ * @author project.kuto
+ */
+
+#include "kuto_indexed_image.h"
+
+
+namespace {
+	const kuto::u32 DEFAULT_BUDGET = 2 * 1024 * 1024;
+}	// namespace
+
+
+namespace kuto {
+
+IndexedImageCache::IndexedImageCache()
+: budget_(DEFAULT_BUDGET), size_(0)
+{
+#if KUTO_LOAD_THREAD
+	pthread_mutex_init(&mutex_, NULL);
+#endif
+}
+
+IndexedImageCache::~IndexedImageCache()
+{
+	clear();
+#if KUTO_LOAD_THREAD
+	pthread_mutex_destroy(&mutex_);
+#endif
+}
+
+/**
+ * デコード済みの画像を検索
+ * @param filename		ファイル名
+ * @return				キャッシュ内の画像（なければNULL）
+ */
+IndexedImageCache::ImagePtr IndexedImageCache::find(const std::string& filename)
+{
+	ImagePtr ret;
+	lock();
+	ImageMap::iterator it = imageMap_.find(filename);
+	if (it != imageMap_.end()) {
+		imageList_.splice(imageList_.end(), imageList_, it->second);	// most recently used
+		ret = it->second->second;
+	}
+	unlock();
+	return ret;
+}
+
+/**
+ * キャッシュに追加
+ * @param filename		ファイル名
+ * @param image			デコードした画像
+ */
+void IndexedImageCache::add(const std::string& filename, ImagePtr image)
+{
+	lock();
+	if (imageMap_.find(filename) == imageMap_.end()) {	// may have been decoded twice by both threads
+		imageMap_[filename] = imageList_.insert(imageList_.end(), std::make_pair(filename, image));
+		size_ += image->memorySize();
+		trim();
+	}
+	unlock();
+}
+
+void IndexedImageCache::clear()
+{
+	lock();
+	imageList_.clear();
+	imageMap_.clear();
+	size_ = 0;
+	unlock();
+}
+
+void IndexedImageCache::setBudget(u32 bytes)
+{
+	lock();
+	budget_ = bytes;
+	trim();
+	unlock();
+}
+
+/**
+ * 予算を超えた分だけ古い画像を解放（ロック中に呼ぶ）
+ */
+void IndexedImageCache::trim()
+{
+	while (size_ > budget_ && imageList_.size() > 1) {	// keep the newest even if it alone is over
+		size_ -= imageList_.front().second->memorySize();
+		imageMap_.erase(imageList_.front().first);
+		imageList_.pop_front();
+	}
+}
+
+}	// namespace kuto
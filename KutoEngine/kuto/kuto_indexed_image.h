@@ -0,0 +1,85 @@
+/**
+ * @file
+ * @brief Indexed Image Cache
+ * @author project.kuto
+ */
+#pragma once
+
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/smart_ptr.hpp>
+#include <boost/unordered_map.hpp>
+#include "kuto_singleton.h"
+#include "kuto_types.h"
+
+#if KUTO_LOAD_THREAD
+	#include <pthread.h>
+#endif
+
+namespace kuto {
+
+/// 8 bit paletted image as stored in the file. textures are expanded from it per hue / transparency
+struct IndexedImage
+{
+	static const int COLOR_NUM = 256;
+	struct Color
+	{
+		u8 red, green, blue;
+	};
+
+	IndexedImage() : width(0), height(0) {}
+	u32 memorySize() const { return sizeof(IndexedImage) + pixels.size(); }
+
+	int					width;
+	int					height;
+	Color				palette[COLOR_NUM];
+	std::vector<u8>		pixels;		///< width * height palette indices, top row first
+};	// struct IndexedImage
+
+/// decoded IndexedImage of each file, so the variants of an image are read and decoded once
+class IndexedImageCache : public Singleton<IndexedImageCache>
+{
+	friend class Singleton<IndexedImageCache>;
+public:
+	typedef boost::shared_ptr<const IndexedImage> ImagePtr;
+
+	/// called from the loader thread too
+	ImagePtr find(const std::string& filename);
+	void add(const std::string& filename, ImagePtr image);
+	void clear();
+
+	/// images are dropped least recently used first past this size
+	void setBudget(u32 bytes);
+	u32 budget() const { return budget_; }
+	u32 size() const { return size_; }
+
+protected:
+	IndexedImageCache();
+	~IndexedImageCache();
+
+private:
+	typedef std::list< std::pair<std::string, ImagePtr> > ImageList;
+	typedef boost::unordered_map<std::string, ImageList::iterator> ImageMap;
+
+	void trim();
+#if KUTO_LOAD_THREAD
+	void lock() { pthread_mutex_lock(&mutex_); }
+	void unlock() { pthread_mutex_unlock(&mutex_); }
+#else
+	void lock() {}
+	void unlock() {}
+#endif
+
+private:
+	ImageList			imageList_;		///< least recently used first
+	ImageMap			imageMap_;		///< filename -> imageList_
+	u32					budget_;		///< cache size limit in bytes
+	u32					size_;			///< bytes held by the images
+#if KUTO_LOAD_THREAD
+	pthread_mutex_t		mutex_;			///< guards the cache
+#endif
+};	// class IndexedImageCache
+
+}	// namespace kuto
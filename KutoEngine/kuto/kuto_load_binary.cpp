@@ -10,7 +10,7 @@
 
 namespace kuto {
 
-LoadCore* LoadBinaryHandle::createCore(const std::string& filename, const char* subname)
+LoadCore* LoadBinaryHandle::createCore(const std::string& filename, const char* subname, bool /* async */)
 {
 	return new LoadBinaryCore(filename, subname);
 }
@@ -16,7 +16,7 @@ public:
 	char* data();
 
 private:
-	virtual LoadCore* createCore(const std::string& filename, const char* subname);
+	virtual LoadCore* createCore(const std::string& filename, const char* subname, bool async);
 };
 
 }	// namespace kuto
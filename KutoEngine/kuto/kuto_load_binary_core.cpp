@@ -14,6 +14,12 @@ LoadBinaryCore::LoadBinaryCore(const std::string& filename, const char* subname,
 : LoadCore(filename, subname), bytes_(NULL)
 {
 	if (readBytes)
+		loadBytes();
+}
+
+void LoadBinaryCore::loadBytes()
+{
+	if (!bytes_)
 		bytes_ = File::readBytes(filename_.c_str(), fileSize_);
 }
 
@@ -16,6 +16,8 @@ public:
 	LoadBinaryCore(const std::string& filename, const char* subname, bool readBytes = true);
 	virtual ~LoadBinaryCore();
 	char* bytes() { return bytes_; }
+	const char* bytes() const { return bytes_; }
+	void loadBytes();
 	void releaseBytes();
 
 private:
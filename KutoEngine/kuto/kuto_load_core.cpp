@@ -11,7 +11,7 @@
 namespace kuto {
 
 LoadCore::LoadCore(const std::string& filename, const char* subname)
-: filename_(filename), refCount_(1), fileSize_(0)
+: filename_(filename), refCount_(1), fileSize_(0), ready_(true)
 {
 	if (subname)
 		subname_ = subname;
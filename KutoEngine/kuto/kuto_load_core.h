@@ -24,6 +24,19 @@ public:
 	const std::string& subname() const { return subname_; }
 	u32 crc() const { return crc_; }
 	u32 fileSize() const { return fileSize_; }
+	/// bytes charged against the LoadManager cache budget. must not change once ready
+	virtual u32 memorySize() const { return fileSize_; }
+
+	/// false while an asynchronous load is in progress
+	bool isReady() const { return ready_; }
+	/// file I/O and decoding. called from the loader thread for asynchronous loads
+	virtual void decode() {}
+	/// finishes the load on the main thread
+	void finishLoad() { upload(); ready_ = true; }
+
+protected:
+	/// main thread part of the load (GL upload)
+	virtual void upload() {}
 
 protected:
 	std::string		filename_;
@@ -31,6 +44,7 @@ protected:
 	u32				crc_;
 	int				refCount_;
 	u32				fileSize_;
+	bool			ready_;
 };
 
 }	// namespace kuto
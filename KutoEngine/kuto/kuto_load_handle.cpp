@@ -24,13 +24,15 @@ LoadHandle::~LoadHandle()
 		release();
 }
 
-bool LoadHandle::load(const std::string& filename, const char* subname)
+bool LoadHandle::load(const std::string& filename, const char* subname, bool async)
 {
 	if (core_)
 		release();
 	core_ = LoadManager::instance().searchLoadCore(filename, subname);
+	if (core_ && !async)
+		LoadManager::instance().waitLoad(core_);
 	if (!core_) {
-		core_ = createCore(filename, subname);
+		core_ = createCore(filename, subname, async);
 		LoadManager::instance().addLoadCore(core_);
 	}
 	return core_ != NULL;
@@ -58,4 +60,15 @@ u32 LoadHandle::crc() const
 	return 0;
 }
 
+bool LoadHandle::isReady() const
+{
+	return core_ && core_->isReady();
+}
+
+void LoadHandle::wait()
+{
+	if (core_)
+		LoadManager::instance().waitLoad(core_);
+}
+
 }	// namespace kuto
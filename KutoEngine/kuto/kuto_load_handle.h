@@ -21,13 +21,17 @@ protected:
 	virtual ~LoadHandle();
 
 public:
-	bool load(const std::string& filename, const char* subname = NULL);
+	bool load(const std::string& filename, const char* subname = NULL, bool async = false);
 	void release();
 	const std::string& filename() const;
 	u32 crc() const;
+	/// false while an asynchronous load is in progress
+	bool isReady() const;
+	/// finishes an asynchronous load now
+	void wait();
 
 private:
-	virtual LoadCore* createCore(const std::string& filename, const char* subname) = 0;
+	virtual LoadCore* createCore(const std::string& filename, const char* subname, bool async) = 0;
 
 protected:
 	LoadCore*		core_;
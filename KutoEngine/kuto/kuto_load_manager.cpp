@@ -4,9 +4,17 @@
  * @author project.kuto
  */
 
+#include <algorithm>
+
 #include "kuto_load_manager.h"
 #include "kuto_load_core.h"
-#include "kuto_utility.h"
+#include "kuto_indexed_image.h"
+#include "kuto_error.h"
+
+
+namespace {
+	const kuto::u32 DEFAULT_CACHE_BUDGET = 16 * 1024 * 1024;
+}	// namespace
 
 
 namespace kuto {
@@ -16,8 +24,18 @@ namespace kuto {
  * @param parent		親タスク
  */
 LoadManager::LoadManager()
-: eraseCoreFlag_(false)
+: cacheBudget_(DEFAULT_CACHE_BUDGET), cacheSize_(0)
+, hitCount_(0), missCount_(0), evictCount_(0)
 {
+#if KUTO_LOAD_THREAD
+	quit_ = false;
+	pthread_mutex_init(&mutex_, NULL);
+	pthread_cond_init(&requestCond_, NULL);
+	pthread_cond_init(&decodedCond_, NULL);
+	// function local statics aren't initialized thread safely, so create the ones the worker uses here
+	IndexedImageCache::instance();
+	pthread_create(&thread_, NULL, &LoadManager::threadMain, this);
+#endif
 }
 
 /**
@@ -25,8 +43,18 @@ LoadManager::LoadManager()
  */
 LoadManager::~LoadManager()
 {
-	for (u32 i = 0; i < coreList_.size(); i++) {
-		delete coreList_[i];
+#if KUTO_LOAD_THREAD
+	lock();
+	quit_ = true;
+	pthread_cond_signal(&requestCond_);
+	unlock();
+	pthread_join(thread_, NULL);
+	pthread_cond_destroy(&decodedCond_);
+	pthread_cond_destroy(&requestCond_);
+	pthread_mutex_destroy(&mutex_);
+#endif
+	for (CoreMap::iterator it = coreMap_.begin(); it != coreMap_.end(); ++it) {
+		delete it->second.core;
 	}
 }
 
@@ -35,22 +63,56 @@ LoadManager::~LoadManager()
  */
 void LoadManager::update()
 {
-	// clear not referenced cache
-	while (eraseCoreFlag_) {
-		eraseCoreFlag_ = false;
-		for (LoadCoreList::iterator it = coreList_.begin(); it != coreList_.end();) {
-			LoadCore* core = *it;
-			if (core->refCount() == 0) {
-				it = coreList_.erase(it);
-				delete core;
-				eraseCoreFlag_ = true;
-			} else {
-				++it;
-			}
+#if !KUTO_LOAD_THREAD
+	// decode one asynchronous load a frame
+	if (!requestQueue_.empty()) {
+		LoadCore* core = requestQueue_.front();
+		requestQueue_.pop_front();
+		core->decode();
+		decodedQueue_.push_back(core);
+	}
+#endif
+	// upload decoded loads
+	LoadQueue decoded;
+	lock();
+	decoded.swap(decodedQueue_);
+	unlock();
+	for (LoadQueue::iterator it = decoded.begin(); it != decoded.end(); ++it) {
+		finishLoad(*it);
+	}
+
+	trimCache();
+}
+
+/**
+ * 予算を超えた分だけ参照されていないLoadCoreを古い順に解放
+ */
+void LoadManager::trimCache()
+{
+	for (LoadCoreList::iterator it = unusedList_.begin(); cacheSize_ > cacheBudget_ && it != unusedList_.end();) {
+		LoadCore* core = *it;
+		if (!core->isReady()) {	// loading cores are freed once finished
+			++it;
+			continue;
 		}
+		it = unusedList_.erase(it);
+		coreMap_.erase(CoreKey(core->filename(), core->subname()));
+		cacheSize_ -= core->memorySize();
+		delete core;
+		evictCount_++;
 	}
 }
 
+/**
+ * 非同期読み込みを完了させる
+ * @param core		完了させるファイル
+ */
+void LoadManager::finishLoad(LoadCore* core)
+{
+	core->finishLoad();
+	cacheSize_ += core->memorySize();
+}
+
 /**
  * 同じ名前のファイルをすでに読み込んでいないか検索
  * @param filename		ファイル名
@@ -59,17 +121,19 @@ void LoadManager::update()
  */
 LoadCore* LoadManager::searchLoadCore(const std::string& filename, const char* subname)
 {
-	std::string crcname(filename);
-	if (subname)
-		crcname += subname;
-	u32 crc = crc32(crcname);
-	for (u32 i = 0; i < coreList_.size(); i++) {
-		if (coreList_[i]->crc() == crc) {
-			coreList_[i]->incRefCount();
-			return coreList_[i];
-		}
+	CoreMap::iterator it = coreMap_.find(CoreKey(filename, subname ? subname : ""));
+	if (it == coreMap_.end()) {
+		missCount_++;
+		return NULL;
 	}
-	return NULL;
+	hitCount_++;
+	CoreEntry& entry = it->second;
+	if (entry.unused != unusedList_.end()) {
+		unusedList_.erase(entry.unused);
+		entry.unused = unusedList_.end();
+	}
+	entry.core->incRefCount();
+	return entry.core;
 }
 
 /**
@@ -78,7 +142,10 @@ LoadCore* LoadManager::searchLoadCore(const std::string& filename, const char* s
  */
 void LoadManager::addLoadCore(LoadCore* core)
 {
-	coreList_.push_back(core);
+	CoreEntry entry = { core, unusedList_.end() };
+	coreMap_.insert(std::make_pair(CoreKey(core->filename(), core->subname()), entry));
+	if (core->isReady())
+		cacheSize_ += core->memorySize();
 }
 
 /**
@@ -88,9 +155,94 @@ void LoadManager::addLoadCore(LoadCore* core)
 void LoadManager::releaseLoadCore(LoadCore* core)
 {
 	core->decRefCount();
-	if (core->refCount() == 0)	// 参照カウンタが0になったらerase
-		eraseCoreFlag_ = true;
+	if (core->refCount() == 0) {	// 参照カウンタが0になったら解放候補へ。実際の解放はupdate()で
+		CoreMap::iterator it = coreMap_.find(CoreKey(core->filename(), core->subname()));
+		kuto_assert(it != coreMap_.end());
+		it->second.unused = unusedList_.insert(unusedList_.end(), core);
+	}
+}
+
+/**
+ * 非同期読み込みを登録
+ * @param core		decode()するファイル
+ */
+void LoadManager::requestLoad(LoadCore* core)
+{
+	lock();
+	requestQueue_.push_back(core);
+#if KUTO_LOAD_THREAD
+	pthread_cond_signal(&requestCond_);
+#endif
+	unlock();
+}
+
+/**
+ * 非同期読み込みをすぐに完了させる
+ * @param core		完了させるファイル
+ */
+void LoadManager::waitLoad(LoadCore* core)
+{
+	if (core->isReady())
+		return;
+	lock();
+	LoadQueue::iterator it = std::find(requestQueue_.begin(), requestQueue_.end(), core);
+	if (it != requestQueue_.end()) {
+		// not started yet. decode here
+		requestQueue_.erase(it);
+		unlock();
+		core->decode();
+	} else {
+#if KUTO_LOAD_THREAD
+		while (!popDecoded(core))
+			pthread_cond_wait(&decodedCond_, &mutex_);
+#else
+		popDecoded(core);
+#endif
+		unlock();
+	}
+	finishLoad(core);
+}
+
+/**
+ * decode済みキューから取り出す（ロック中に呼ぶ）
+ * @param core		取り出すファイル
+ * @return			見つかったか
+ */
+bool LoadManager::popDecoded(LoadCore* core)
+{
+	LoadQueue::iterator it = std::find(decodedQueue_.begin(), decodedQueue_.end(), core);
+	if (it == decodedQueue_.end())
+		return false;
+	decodedQueue_.erase(it);
+	return true;
+}
+
+#if KUTO_LOAD_THREAD
+/**
+ * 読み込みスレッド
+ * @param manager	LoadManager
+ */
+void* LoadManager::threadMain(void* manager)
+{
+	LoadManager& self = *static_cast<LoadManager*>(manager);
+	self.lock();
+	while (!self.quit_) {
+		if (self.requestQueue_.empty()) {
+			pthread_cond_wait(&self.requestCond_, &self.mutex_);
+			continue;
+		}
+		LoadCore* core = self.requestQueue_.front();
+		self.requestQueue_.pop_front();
+		self.unlock();
+		core->decode();
+		self.lock();
+		self.decodedQueue_.push_back(core);
+		pthread_cond_broadcast(&self.decodedCond_);
+	}
+	self.unlock();
+	return NULL;
 }
+#endif
 
 
 
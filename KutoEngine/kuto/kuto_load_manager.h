@@ -5,9 +5,17 @@
  */
 #pragma once
 
+#include <deque>
+#include <list>
 #include <string>
-#include "kuto_static_vector.h"
+#include <utility>
+#include <boost/unordered_map.hpp>
 #include "kuto_task_singleton.h"
+#include "kuto_types.h"
+
+#if KUTO_LOAD_THREAD
+	#include <pthread.h>
+#endif
 
 namespace kuto {
 
@@ -22,19 +30,70 @@ public:
 	void addLoadCore(LoadCore* core);
 	void releaseLoadCore(LoadCore* core);
 
+	/// queues LoadCore::decode() of an asynchronous load
+	void requestLoad(LoadCore* core);
+	/// finishes an asynchronous load now, waiting for the worker if it's decoding the core
+	void waitLoad(LoadCore* core);
+
+	/// finishes decoded loads and frees unreferenced cores. called once a frame
+	virtual void update();
+
+	/// bytes the cache may hold. unreferenced cores are kept until it's exceeded
+	void setCacheBudget(u32 bytes) { cacheBudget_ = bytes; }
+	u32 cacheBudget() const { return cacheBudget_; }
+	/// bytes held by every loaded core
+	u32 cacheSize() const { return cacheSize_; }
+	u32 coreCount() const { return coreMap_.size(); }
+	u32 hitCount() const { return hitCount_; }
+	u32 missCount() const { return missCount_; }
+	u32 evictCount() const { return evictCount_; }
+
 protected:
 	LoadManager();
 	virtual ~LoadManager();
 
-	virtual void update();
-
 private:
-	/// LoadCoreのリスト
-	typedef StaticVector<LoadCore*, 256> LoadCoreList;
+	/// unreferenced cores, least recently released first
+	typedef std::list<LoadCore*> LoadCoreList;
+	struct CoreEntry
+	{
+		LoadCore*				core;
+		LoadCoreList::iterator	unused;		///< position in unusedList_. end() while referenced
+	};
+	/// (filename, subname) -> LoadCore
+	typedef std::pair<std::string, std::string> CoreKey;
+	typedef boost::unordered_map<CoreKey, CoreEntry> CoreMap;
+	typedef std::deque<LoadCore*> LoadQueue;
+
+	void finishLoad(LoadCore* core);
+	void trimCache();
+	bool popDecoded(LoadCore* core);
+#if KUTO_LOAD_THREAD
+	static void* threadMain(void* manager);
+	void lock() { pthread_mutex_lock(&mutex_); }
+	void unlock() { pthread_mutex_unlock(&mutex_); }
+#else
+	void lock() {}
+	void unlock() {}
+#endif
 
 private:
-	LoadCoreList		coreList_;			///< LoadCoreリスト
-	bool				eraseCoreFlag_;		///< LoadCoreでeraseするものがあるよフラグ
+	CoreMap				coreMap_;			///< every loaded core
+	LoadCoreList		unusedList_;		///< cores no handle refers to, LRU order
+	u32					cacheBudget_;		///< cache size limit in bytes
+	u32					cacheSize_;			///< bytes held by the ready cores
+	u32					hitCount_;			///< searchLoadCore() hits
+	u32					missCount_;			///< searchLoadCore() misses
+	u32					evictCount_;		///< cores freed by trimCache()
+	LoadQueue			requestQueue_;		///< cores waiting for decode()
+	LoadQueue			decodedQueue_;		///< decoded cores waiting for finishLoad() on the main thread
+#if KUTO_LOAD_THREAD
+	pthread_t			thread_;			///< worker thread
+	pthread_mutex_t		mutex_;				///< guards the queues and quit_
+	pthread_cond_t		requestCond_;		///< signaled on requestLoad() and quit
+	pthread_cond_t		decodedCond_;		///< signaled when a core is decoded
+	bool				quit_;				///< worker thread exit flag
+#endif
 };	// class LoadManager
 
 }	// namespace kuto
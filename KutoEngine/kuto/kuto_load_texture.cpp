@@ -10,19 +10,21 @@
 
 namespace kuto {
 
-bool LoadTextureHandle::load(const std::string& filename, bool useAlphaPalette, int hue)
+bool LoadTextureHandle::load(const std::string& filename, bool useAlphaPalette, int hue, bool async, bool keepData)
 {
 	std::string subname(useAlphaPalette? "$ay":"$an");
 	subname += "$h";
 	char huestr[32];
 	sprintf(huestr, "%d", hue);
 	subname += huestr;
-	return LoadHandle::load(filename, subname.c_str());
+	if (keepData)
+		subname += "$k";
+	return LoadHandle::load(filename, subname.c_str(), async);
 }
 
-LoadCore* LoadTextureHandle::createCore(const std::string& filename, const char* subname)
+LoadCore* LoadTextureHandle::createCore(const std::string& filename, const char* subname, bool async)
 {
-	return new LoadTextureCore(filename, subname);
+	return new LoadTextureCore(filename, subname, async);
 }
 
 GLuint LoadTextureHandle::glTexture() const
@@ -60,5 +62,10 @@ GLenum LoadTextureHandle::format() const
 	return core_? static_cast<LoadTextureCore*>(core_)->format() : 0;
 }
 
+GLenum LoadTextureHandle::type() const
+{
+	return core_? static_cast<LoadTextureCore*>(core_)->type() : GL_UNSIGNED_BYTE;
+}
+
 }	// namespace kuto
 
@@ -14,7 +14,8 @@ namespace kuto {
 class LoadTextureHandle : public LoadHandle
 {
 public:
-	bool load(const std::string& filename, bool useAlphaPalette, int hue);
+	/// keepData keeps the decoded pixels after the GL upload (for Texture::updateImage)
+	bool load(const std::string& filename, bool useAlphaPalette, int hue, bool async = false, bool keepData = false);
 
 	GLuint glTexture() const;
 	char* data();
@@ -23,9 +24,10 @@ public:
 	int orgWidth() const;
 	int orgHeight() const;
 	GLenum format() const;
+	GLenum type() const;
 
 private:
-	virtual LoadCore* createCore(const std::string& filename, const char* subname);
+	virtual LoadCore* createCore(const std::string& filename, const char* subname, bool async);
 };
 
 }	// namespace kuto
@@ -7,13 +7,17 @@
 #include "kuto_load_texture_core.h"
 #include "kuto_graphics_device.h"
 #include "kuto_file.h"
+#include "kuto_load_manager.h"
 #include "kuto_png_loader.h"
 #include "kuto_xyz_loader.h"
 #include "kuto_bmp_loader.h"
+#include "kuto_color.h"
+#include "kuto_utility.h"
 #if RPG2K_IS_IPHONE
 	#include "kuto_image_loader.h"
 #endif
 #include <cstdlib>
+#include <cstring>
 
 
 namespace
@@ -27,17 +31,40 @@ namespace
 
 namespace kuto {
 
-LoadTextureCore::LoadTextureCore(const std::string& filename, const char* subname)
-: LoadBinaryCore(filename, subname, isReadBytes(File::extension(filename)))
-, name_(0), data_(NULL), width_(0), height_(0), orgWidth_(0), orgHeight_(0), format_(GL_RGB)
+bool LoadTextureCore::palette16Bit_ = true;
+
+LoadTextureCore::LoadTextureCore(const std::string& filename, const char* subname, bool async)
+: LoadBinaryCore(filename, subname, false)
+, name_(0), data_(NULL), width_(0), height_(0), orgWidth_(0), orgHeight_(0), format_(GL_RGB), type_(GL_UNSIGNED_BYTE)
 {
-	std::string ext = File::extension(filename);
-	if (ext == "png") {
-		PngLoader().createTexture(bytes(), *this, useAlphaPalette(), hue());
-	} else if (ext == "xyz") {
-		XyzLoader().createTexture(bytes(), *this, useAlphaPalette(), hue());
-	} else if (ext == "bmp") {
-		BmpLoader().createTexture(bytes(), *this, useAlphaPalette(), hue());
+	if (async) {
+		ready_ = false;
+		LoadManager::instance().requestLoad(this);
+	} else {
+		decode();
+		finishLoad();
+	}
+}
+
+void LoadTextureCore::decode()
+{
+	std::string ext = File::extension(filename_);
+	if (isReadBytes(ext)) {
+		// paletted images are decoded once per file and shared by the hue / transparency variants
+		IndexedImageCache::ImagePtr image = IndexedImageCache::instance().find(filename_);
+		if (!image) {
+			loadBytes();
+			image = decodeIndexed(ext);
+			if (image)
+				IndexedImageCache::instance().add(filename_, image);
+		}
+		if (image) {
+			createTexture(*image);
+		} else if (ext == "png") {
+			PngLoader().createTexture(bytes(), *this);
+		} else if (ext == "bmp") {
+			BmpLoader().createTexture(bytes(), *this);
+		}
 	} else {
 #if RPG2K_IS_IPHONE
 		ImageLoader().createTexture(filename_.c_str(), *this);
@@ -45,12 +72,101 @@ LoadTextureCore::LoadTextureCore(const std::string& filename, const char* subnam
 		kuto_assert(false);
 #endif
 	}
+	if (data_ != bytes())
+		releaseBytes();		// the file image isn't needed once decoded
+}
+
+IndexedImageCache::ImagePtr LoadTextureCore::decodeIndexed(const std::string& ext)
+{
+	boost::shared_ptr<IndexedImage> image(new IndexedImage());
+	bool decoded = false;
+	if (ext == "png") {
+		decoded = PngLoader().decodeIndexed(bytes(), *image);
+	} else if (ext == "xyz") {
+		decoded = XyzLoader().decodeIndexed(bytes(), *image);
+	} else if (ext == "bmp") {
+		decoded = BmpLoader().decodeIndexed(bytes(), *image);
+	}
+	return decoded? image : IndexedImageCache::ImagePtr();
+}
+
+/**
+ * パレット画像から色相・透過色を適用してテクスチャデータを作る
+ * @param image		デコード済みの画像
+ */
+bool LoadTextureCore::createTexture(const IndexedImage& image)
+{
+	if (image.pixels.empty())
+		return false;
+	bool alpha = useAlphaPalette();
+	int hueShift = hue();
+
+	IndexedImage::Color palette[IndexedImage::COLOR_NUM];
+	std::memcpy(palette, image.palette, sizeof(palette));
+	if (hueShift != 0) {
+		for (int i = 0; i < IndexedImage::COLOR_NUM; i++) {
+			IndexedImage::Color& color = palette[i];
+			ColorHSV hsv = Color(color.red / 255.f, color.green / 255.f, color.blue / 255.f, 1.f).hsv();
+			hsv.h += hueShift;
+			if (hsv.h < 0)
+				hsv.h += 360;
+			else if (hsv.h >= 360)
+				hsv.h -= 360;
+			Color rgb = hsv.rgb();
+			color.red = (u8)(rgb.r * 255.f);
+			color.green = (u8)(rgb.g * 255.f);
+			color.blue = (u8)(rgb.b * 255.f);
+		}
+	}
+
+	int texWidth = fixPowerOfTwo(image.width);
+	int texHeight = fixPowerOfTwo(image.height);
+	GLenum format = alpha? GL_RGBA : GL_RGB;
+	GLenum type = GL_UNSIGNED_BYTE;
+	int pixelSize = alpha? 4 : 3;
+	if (palette16Bit_) {
+		type = alpha? GL_UNSIGNED_SHORT_5_5_5_1 : GL_UNSIGNED_SHORT_5_6_5;
+		pixelSize = 2;
+	}
+	char* data = new char[texWidth * texHeight * pixelSize];
+	std::memset(data, 0, texWidth * texHeight * pixelSize);
+
+	const u8* src = &image.pixels[0];
+	if (palette16Bit_) {
+		u16 texel[IndexedImage::COLOR_NUM];
+		for (int i = 0; i < IndexedImage::COLOR_NUM; i++) {
+			const IndexedImage::Color& color = palette[i];
+			texel[i] = alpha? packRGBA5551(color.red, color.green, color.blue, i != 0)
+				: packRGB565(color.red, color.green, color.blue);
+		}
+		for (int y = 0; y < image.height; y++) {
+			u16* dst = reinterpret_cast<u16*>(data) + y * texWidth;
+			for (int x = 0; x < image.width; x++) {
+				*dst++ = texel[*src++];
+			}
+		}
+	} else {
+		for (int y = 0; y < image.height; y++) {
+			u8* dst = reinterpret_cast<u8*>(data) + y * texWidth * pixelSize;
+			for (int x = 0; x < image.width; x++) {
+				const IndexedImage::Color& color = palette[*src];
+				dst[0] = color.red;
+				dst[1] = color.green;
+				dst[2] = color.blue;
+				if (alpha)
+					dst[3] = (*src == 0)? 0x00 : 0xff;
+				src++;
+				dst += pixelSize;
+			}
+		}
+	}
+	return createTexture(data, texWidth, texHeight, image.width, image.height, format, type);
 }
 
 LoadTextureCore::~LoadTextureCore()
 {
 	if (name_) {
-		glDeleteTextures(1, &name_);
+		GraphicsDevice::instance().deleteTexture(name_);
 		name_ = 0;
 	}
 	if (data_ && data_ != bytes()) {
@@ -60,7 +176,7 @@ LoadTextureCore::~LoadTextureCore()
 	releaseBytes();
 }
 
-bool LoadTextureCore::createTexture(char* data, int width, int height, int orgWidth, int orgHeight, GLenum format)
+bool LoadTextureCore::createTexture(char* data, int width, int height, int orgWidth, int orgHeight, GLenum format, GLenum type)
 {
 	data_ = data;
 	width_ = width;
@@ -68,10 +184,12 @@ bool LoadTextureCore::createTexture(char* data, int width, int height, int orgWi
 	orgWidth_ = orgWidth;
 	orgHeight_ = orgHeight;
 	format_ = format;
+	type_ = type;
+	return true;
+}
 
-	glGenTextures(1, &name_);
-	GraphicsDevice::instance().setTexture2D(true, name_);
-	glTexImage2D(GL_TEXTURE_2D, 0, format_, width_, height_, 0, format_, GL_UNSIGNED_BYTE, data_);
+void LoadTextureCore::upload()
+{
 /*
 #if RPG2K_IS_WINDOWS
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
@@ -81,11 +199,34 @@ bool LoadTextureCore::createTexture(char* data, int width, int height, int orgWi
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 #endif
  */
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	return true;
+	name_ = GraphicsDevice::instance().createTexture(width_, height_, format_, type_, data_, GL_REPEAT);
+
+	// GL owns the pixels now
+	if (!keepData() && data_ != bytes()) {
+		delete[] data_;
+		data_ = NULL;
+	}
+}
+
+u32 LoadTextureCore::memorySize() const
+{
+	u32 pixelSize = 4;
+	if (type_ != GL_UNSIGNED_BYTE) {
+		pixelSize = 2;	// packed 16 bit
+	} else {
+		switch (format_) {
+		case GL_RGB:				pixelSize = 3; break;
+		case GL_LUMINANCE_ALPHA:	pixelSize = 2; break;
+		case GL_LUMINANCE:
+		case GL_ALPHA:				pixelSize = 1; break;
+		}
+	}
+	u32 size = width_ * height_ * pixelSize;	// GL texture
+	if (data_ && data_ != bytes())
+		size *= 2;								// and the CPU copy
+	if (bytes())
+		size += fileSize_;
+	return size;
 }
 
 bool LoadTextureCore::useAlphaPalette() const
@@ -93,6 +234,11 @@ bool LoadTextureCore::useAlphaPalette() const
 	return subname().find("$ay") != std::string::npos;
 }
 
+bool LoadTextureCore::keepData() const
+{
+	return subname().find("$k") != std::string::npos;
+}
+
 int LoadTextureCore::hue() const
 {
 	std::string::size_type i = subname().find("$h");
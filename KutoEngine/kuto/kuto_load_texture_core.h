@@ -7,6 +7,7 @@
 
 #include "kuto_gl.h"
 #include "kuto_load_binary_core.h"
+#include "kuto_indexed_image.h"
 
 
 namespace kuto {
@@ -14,10 +15,16 @@ namespace kuto {
 class LoadTextureCore : public LoadBinaryCore
 {
 public:
-	LoadTextureCore(const std::string& filename, const char* subname);
+	LoadTextureCore(const std::string& filename, const char* subname, bool async);
 	virtual ~LoadTextureCore();
 
-	bool createTexture(char* data, int width, int height, int orgWidth, int orgHeight, GLenum format);
+	virtual void decode();
+	/// called by the image loaders with the decoded image. the GL texture is created by upload()
+	bool createTexture(char* data, int width, int height, int orgWidth, int orgHeight, GLenum format, GLenum type = GL_UNSIGNED_BYTE);
+
+	/// paletted images are decoded to RGB565 / RGBA5551 instead of RGB888 / RGBA8888 when set (default)
+	static void setPalette16Bit(bool value) { palette16Bit_ = value; }
+	static bool palette16Bit() { return palette16Bit_; }
 
 	GLuint glTexture() const { return name_; }
 	char* data() { return data_; }
@@ -26,9 +33,15 @@ public:
 	int orgWidth() const { return orgWidth_; }
 	int orgHeight() const { return orgHeight_; }
 	GLenum format() const { return format_; }
+	GLenum type() const { return type_; }
+	virtual u32 memorySize() const;
 
 private:
+	IndexedImageCache::ImagePtr decodeIndexed(const std::string& ext);
+	bool createTexture(const IndexedImage& image);
+	virtual void upload();
 	bool useAlphaPalette() const;
+	bool keepData() const;
 	int hue() const;
 
 private:
@@ -39,6 +52,8 @@ private:
 	int			orgWidth_;		///< original texture width
 	int			orgHeight_;		///< original texture height
 	GLenum		format_;		///< OpenGL texture format
+	GLenum		type_;			///< OpenGL pixel type
+	static bool	palette16Bit_;	///< decode paletted images to 16 bit
 };
 
 }	// namespace kuto
@@ -32,15 +32,41 @@
 
 namespace kuto {
 
+namespace {
+#if KUTO_LOAD_THREAD
+	class ScopedLock
+	{
+	public:
+		ScopedLock(pthread_mutex_t& m) : mutex_(m) { pthread_mutex_lock(&mutex_); }
+		~ScopedLock() { pthread_mutex_unlock(&mutex_); }
+	private:
+		pthread_mutex_t& mutex_;
+	};
+#endif
+}	// namespace
+
 Memory::Memory()
 : disableSmallAllocator_(false)
 {
 	std::memset(allocSize_, 0, sizeof(allocSize_));
 	std::memset(allocCount_, 0, sizeof(allocCount_));
+#if KUTO_LOAD_THREAD
+	pthread_mutex_init(&mutex_, NULL);
+#endif
+}
+
+Memory::~Memory()
+{
+#if KUTO_LOAD_THREAD
+	pthread_mutex_destroy(&mutex_);
+#endif
 }
 
 void* Memory::allocImpl(AllocType type, uint size)
 {
+#if KUTO_LOAD_THREAD
+	ScopedLock lock(mutex_);
+#endif
 	u8* ret = NULL;
 	if (
 		!disableSmallAllocator_ &&
@@ -61,6 +87,9 @@ void* Memory::allocImpl(AllocType type, uint size)
 
 void Memory::deallocImpl(AllocType type, void* mem)
 {
+#if KUTO_LOAD_THREAD
+	ScopedLock lock(mutex_);
+#endif
 	if (smallAllocator_.free(mem)) {
 		return;
 	}
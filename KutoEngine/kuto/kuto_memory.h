@@ -7,6 +7,10 @@
 
 #include "kuto_small_memory_allocator.h"
 #include "kuto_singleton.h"
+#include "kuto_types.h"
+#if KUTO_LOAD_THREAD
+	#include <pthread.h>
+#endif
 
 
 namespace kuto {
@@ -38,12 +42,16 @@ public:
 
 protected:
 	Memory();
+	~Memory();
 
 private:
 	bool disableSmallAllocator_;
 	int							allocSize_[kAllocTypeMax];
 	int							allocCount_[kAllocTypeMax];
 	SmallMemoryAllocator		smallAllocator_;
+#if KUTO_LOAD_THREAD
+	pthread_mutex_t				mutex_;		///< the loader thread allocates too
+#endif
 
 	struct MemInfo
 	{
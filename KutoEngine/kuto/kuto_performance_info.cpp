@@ -8,6 +8,7 @@
 #include "kuto_render_manager.h"
 #include "kuto_graphics_device.h"
 #include "kuto_graphics2d.h"
+#include "kuto_load_manager.h"
 
 #include <rpg2k/Define.hpp>
 
@@ -84,6 +85,12 @@ void PerformanceInfo::render(kuto::Graphics2D& g) const
 	pos.x = middle;
 	sprintf(str, "Render: %.2f%%", renderTime_); g.drawText(str, pos, FONT_OPTIONS);
 
+	LoadManager const& load = LoadManager::instance();
+	pos.x = 0.f; pos.y += 13.f;
+	sprintf(str, "Cache : %4uKB/%3u", unsigned(load.cacheSize() / 1024), unsigned(load.coreCount())); g.drawText(str, pos, FONT_OPTIONS);
+	pos.x = middle;
+	sprintf(str, "H/M/E : %u/%u/%u", unsigned(load.hitCount()), unsigned(load.missCount()), unsigned(load.evictCount())); g.drawText(str, pos, FONT_OPTIONS);
+
 	pos.x = 0.f; pos.y += 13.f;
 
 	#undef FONT_OPTIONS
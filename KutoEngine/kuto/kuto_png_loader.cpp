@@ -5,10 +5,12 @@
  */
 
 #include "kuto_png_loader.h"
+#include "kuto_indexed_image.h"
 #include "kuto_load_texture_core.h"
 #include "kuto_error.h"
 #include "kuto_utility.h"
 #include <cstring>
+#include <vector>
 
 
 namespace kuto {
@@ -45,15 +47,62 @@ PngLoader::~PngLoader()
 	png_destroy_read_struct(&pngStruct_, &pngInfo_, NULL);
 }
 
-bool PngLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaPalette, int hue)
+bool PngLoader::readInfo(char* bytes, PngReaderIO& reader)
 {
 	bytes_ = bytes;
 	if (!bytes_)
 		return false;
 
-	PngReaderIO reader(bytes_);
 	png_set_read_fn(pngStruct_, (png_voidp)&reader, (png_rw_ptr)pngReadFunc);
 	png_read_info(pngStruct_, pngInfo_);
+	return true;
+}
+
+bool PngLoader::decodeIndexed(char* bytes, IndexedImage& image)
+{
+	PngReaderIO reader(bytes);
+	if (!readInfo(bytes, reader))
+		return false;
+
+	png_uint_32 pngWidth;
+	png_uint_32 pngHeight;
+	int pngDepth;
+	int pngColorType;
+	png_get_IHDR(pngStruct_, pngInfo_, &pngWidth, &pngHeight, &pngDepth, &pngColorType, NULL, NULL, NULL);
+	if (pngColorType != PNG_COLOR_TYPE_PALETTE)
+		return false;
+
+	png_color* palette = NULL;
+	int num_palette = 0;
+	png_get_PLTE(pngStruct_, pngInfo_, &palette, &num_palette);
+	std::memset(image.palette, 0, sizeof(image.palette));
+	for (int i = 0; i < num_palette && i < IndexedImage::COLOR_NUM; i++) {
+		image.palette[i].red = palette[i].red;
+		image.palette[i].green = palette[i].green;
+		image.palette[i].blue = palette[i].blue;
+	}
+
+	if (pngDepth < 8)
+		png_set_packing(pngStruct_);		// 1 index a byte
+	png_read_update_info(pngStruct_, pngInfo_);
+
+	image.width = pngWidth;
+	image.height = pngHeight;
+	image.pixels.resize(pngWidth * pngHeight);
+	std::vector<png_bytep> rows(pngHeight);
+	for (uint i = 0; i < pngHeight; i++) {
+		rows[i] = &image.pixels[i * pngWidth];
+	}
+	png_read_image(pngStruct_, &rows[0]);
+	png_read_end(pngStruct_, pngInfo_);
+	return true;
+}
+
+bool PngLoader::createTexture(char* bytes, LoadTextureCore& core)
+{
+	PngReaderIO reader(bytes);
+	if (!readInfo(bytes, reader))
+		return false;
 
 	png_uint_32 pngWidth;
 	png_uint_32 pngHeight;
@@ -64,55 +113,13 @@ bool PngLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
 	int width = fixPowerOfTwo(pngWidth);		// fix 2^x
 	int height = fixPowerOfTwo(pngHeight);		// fix 2^x
 	int depth = 24;
-	//int colorType;
-	//int palSize = 0;
-	png_color* palette = NULL;
-	int num_palette = 0;
 	if (pngColorType == PNG_COLOR_TYPE_RGB) {
 		depth = 24;
 	} else if (pngColorType == PNG_COLOR_TYPE_RGB_ALPHA) {
 		depth = 32;
-	} else if (pngColorType == PNG_COLOR_TYPE_PALETTE) {
-		//png_bytep trans;
-		//int num_trans = 0;
-		//if (png_get_tRNS(pngStruct_, pngInfo_, &trans, &num_trans, NULL))
-		//	depth = 32;
-		//else
-		//	depth = 24;
-		if (useAlphaPalette)
-			depth = 32;
-		else
-			depth = 24;
-		png_get_PLTE(pngStruct_, pngInfo_, &palette, &num_palette);
-		if (hue != 0) {
-			// hue shift
-			for (int i = 0; i < num_palette; i++) {
-				png_color color = palette[i];
-				ColorHSV hsv = Color(color.red / 255.f, color.green / 255.f, color.blue / 255.f, 1.f).hsv();
-				hsv.h += hue;
-				if (hsv.h < 0)
-					hsv.h += 360;
-				else if (hsv.h >= 360)
-					hsv.h -= 360;
-				Color rgb = hsv.rgb();
-				palette[i].red = (u8)(rgb.r * 255.f);
-				palette[i].green = (u8)(rgb.g * 255.f);
-				palette[i].blue = (u8)(rgb.b * 255.f);
-			}
-		}
-		//png_set_expand(pngStruct_);
-		//png_set_filler(pngStruct_, 0, 1);
 	} else {
-		kuto_assert(0);		// No Support
-#if 0
-		switch (pngDepth) {
-		case 2:  nDepth = 4; break;
-		case 16: nDepth = 8; break;
-		default: nDepth = nPngDepth; break;
-		}
-		depth = 32;
-		palSize = 1 << nDepth;
-#endif
+		kuto_assert(0);		// No Support (paletted images go through decodeIndexed())
+		return false;
 	}
     if (pngDepth == 16)
         png_set_strip_16(pngStruct_);
@@ -123,8 +130,8 @@ bool PngLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
     int pngRowbytes = png_get_rowbytes(pngStruct_, pngInfo_);
     int pngChannels = png_get_channels(pngStruct_, pngInfo_);
 	png_bytep pngData = new png_byte[pngRowbytes * pngHeight];
-	png_bytep* rows = new png_bytep[height];
-	for (int i = 0; i < height; i++) {
+	png_bytep* rows = new png_bytep[pngHeight];
+	for (uint i = 0; i < pngHeight; i++) {
 		rows[i] = (png_bytep)&pngData[i * pngRowbytes];
 	}
 
@@ -139,27 +146,14 @@ bool PngLoader::createTexture(char* bytes, LoadTextureCore& core, bool useAlphaP
         png_bytep src = pngData + row * pngRowbytes;
         png_bytep dest = (png_bytep)(imageData + row * imageRowSize);
 
-        if (pngChannels == 1) {     // パレット（またはグレースケール）
-            for (uint i = 0; i < pngWidth; i++) {
-                png_color color = palette[*src];
-                dest[0] = color.red;
-                dest[1] = color.green;
-                dest[2] = color.blue;
-				if (depth == 32)
-					dest[3] = *src == 0? 0x00:0xFF;
-                src++;
-                dest += imageByteSize;
-            }
-        } else {  // RGB or RGBA
-            for (uint i = 0; i < pngWidth; i++) {
-                dest[0] = src[0];  // b
-                dest[1] = src[1];  // g
-                dest[2] = src[2];  // r
-				if (depth == 32)
-					dest[3] = src[3];
-				src += pngChannels;
-				dest += imageByteSize;
-            }
+        for (uint i = 0; i < pngWidth; i++) {
+            dest[0] = src[0];  // b
+            dest[1] = src[1];  // g
+            dest[2] = src[2];  // r
+			if (depth == 32)
+				dest[3] = src[3];
+			src += pngChannels;
+			dest += imageByteSize;
         }
     }
 	delete[] pngData;
@@ -11,6 +11,8 @@
 namespace kuto {
 
 class LoadTextureCore;
+class PngReaderIO;
+struct IndexedImage;
 
 
 class PngLoader
@@ -19,7 +21,13 @@ public:
 	PngLoader();
 	~PngLoader();
 
-	bool createTexture(char* bytes, LoadTextureCore& core, bool useAlphaPalette, int hue);
+	/// reads a paletted image. false for the other color types
+	bool decodeIndexed(char* bytes, IndexedImage& image);
+	/// truecolor images
+	bool createTexture(char* bytes, LoadTextureCore& core);
+
+private:
+	bool readInfo(char* bytes, PngReaderIO& reader);
 
 private:
 	char*				bytes_;
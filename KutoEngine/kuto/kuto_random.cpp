@@ -0,0 +1,103 @@
+/**
+ * @file
+ * @brief Random
+ * @author project.kuto
+ */
+
+#include <ctime>
+#include "kuto_random.h"
+#include "kuto_error.h"
+
+
+namespace kuto {
+
+namespace
+{
+	Random gStreams[RANDOM_STREAM_MAX];
+
+	inline u32 rotl(u32 x, int k) { return (x << k) | (x >> (32 - k)); }
+
+	/// splitmix32. spreads a seed over the state words
+	u32 splitMix(u32& x)
+	{
+		u32 z = (x += 0x9e3779b9u);
+		z = (z ^ (z >> 16)) * 0x85ebca6bu;
+		z = (z ^ (z >> 13)) * 0xc2b2ae35u;
+		return z ^ (z >> 16);
+	}
+}	// namespace
+
+void Random::seed(u32 seed)
+{
+	for (int i = 0; i < STATE_SIZE; i++)
+		state_[i] = splitMix(seed);
+}
+
+u32 Random::next()
+{
+	u32 const result = rotl(state_[1] * 5, 7) * 9;
+	u32 const t = state_[1] << 9;
+	state_[2] ^= state_[0];
+	state_[3] ^= state_[1];
+	state_[1] ^= state_[2];
+	state_[0] ^= state_[3];
+	state_[2] ^= t;
+	state_[3] = rotl(state_[3], 11);
+	return result;
+}
+
+void Random::setState(const u32* state)
+{
+	bool zero = true;
+	for (int i = 0; i < STATE_SIZE; i++) {
+		state_[i] = state[i];
+		zero = zero && state[i] == 0;
+	}
+	if (zero)		// the generator would only return 0
+		seed(0);
+}
+
+
+Random& randomStream(RandomStream stream)
+{
+	kuto_assert(stream < RANDOM_STREAM_MAX);
+	return gStreams[stream];
+}
+
+void randomize()
+{
+	randomize((u32)time(NULL));
+}
+
+/**
+ * 乱数の初期化
+ * 同じシードなら全ストリームが同じ系列を返す
+ * @param seed		シード
+ */
+void randomize(u32 seed)
+{
+	for (int i = 0; i < RANDOM_STREAM_MAX; i++)
+		gStreams[i].seed(seed + i * 0x6c078965u);
+}
+
+std::vector<u32> randomState()
+{
+	std::vector<u32> state;
+	state.reserve(RANDOM_STREAM_MAX * Random::STATE_SIZE);
+	for (int i = 0; i < RANDOM_STREAM_MAX; i++)
+		state.insert(state.end(), gStreams[i].state(), gStreams[i].state() + Random::STATE_SIZE);
+	return state;
+}
+
+/**
+ * 乱数の状態を戻す
+ * 足りないストリーム（古いセーブデータ）はそのまま
+ * @param state		randomState()で取得した状態
+ */
+void setRandomState(const std::vector<u32>& state)
+{
+	for (int i = 0; i < RANDOM_STREAM_MAX && (i + 1) * Random::STATE_SIZE <= (int)state.size(); i++)
+		gStreams[i].setState(&state[i * Random::STATE_SIZE]);
+}
+
+}	// namespace kuto
@@ -0,0 +1,58 @@
+/**
+ * @file
+ * @brief Random
+ * @author project.kuto
+ */
+#pragma once
+
+#include <vector>
+#include "kuto_types.h"
+
+
+namespace kuto {
+
+/// xoshiro128** generator. the whole state is 4 words so it can be saved and restored
+class Random
+{
+public:
+	enum { STATE_SIZE = 4, };
+
+	explicit Random(u32 seed = 0) { this->seed(seed); }
+
+	void seed(u32 seed);
+	u32 next();
+	/// [0, max). 0 when max <= 0
+	int random(int max) { return (max > 0)? int( (u64(next()) * u32(max)) >> 32 ) : 0; }
+	uint random(uint max) { return uint( (u64(next()) * max) >> 32 ); }
+	float random(float max) { return float(next() >> 8) * (1.f / 16777216.f) * max; }
+
+	const u32* state() const { return state_; }
+	void setState(const u32* state);
+
+private:
+	u32					state_[STATE_SIZE];
+};	// class Random
+
+
+/// independent streams, so that one subsystem drawing more numbers doesn't shift the others
+enum RandomStream {
+	RANDOM_SYSTEM,			///< effects and everything else
+	RANDOM_BATTLE,
+	RANDOM_MAP,				///< map event movement
+	RANDOM_EVENT,			///< event commands
+	RANDOM_STREAM_MAX
+};
+
+Random& randomStream(RandomStream stream);
+/// seeds every stream from the time
+void randomize();
+void randomize(u32 seed);
+/// states of every stream, RANDOM_STREAM_MAX * Random::STATE_SIZE words
+std::vector<u32> randomState();
+void setRandomState(const std::vector<u32>& state);
+
+inline float random(float max, RandomStream stream = RANDOM_SYSTEM) { return randomStream(stream).random(max); }
+inline int random(int max, RandomStream stream = RANDOM_SYSTEM) { return randomStream(stream).random(max); }
+inline uint random(uint max, RandomStream stream = RANDOM_SYSTEM) { return randomStream(stream).random(max); }
+
+}	// namespace kuto
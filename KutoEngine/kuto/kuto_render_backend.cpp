@@ -0,0 +1,120 @@
+/**
+ * @file
+ * @brief Render Backend
+ * @author project.kuto
+ */
+
+#include "kuto_render_backend.h"
+#include "kuto_error.h"
+
+
+namespace kuto {
+
+void GLRenderBackend::clear(const Color& color)
+{
+	glClearColor(color.r, color.g, color.b, color.a);
+	glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void GLRenderBackend::setMatrixMode(GLenum mode)
+{
+	glMatrixMode(mode);
+}
+
+void GLRenderBackend::loadMatrix(const Matrix& matrix)
+{
+	glLoadMatrixf(matrix.pointer());
+}
+
+void GLRenderBackend::setViewport(const Viewport& viewport)
+{
+	glViewport(viewport.x, viewport.y, viewport.width, viewport.height);
+}
+
+void GLRenderBackend::setClientState(GLenum state, bool enable)
+{
+	if (enable)
+		glEnableClientState(state);
+	else
+		glDisableClientState(state);
+}
+
+void GLRenderBackend::setEnable(GLenum state, bool enable)
+{
+	if (enable)
+		glEnable(state);
+	else
+		glDisable(state);
+}
+
+void GLRenderBackend::setBlendFunc(GLenum srcFactor, GLenum destFactor)
+{
+	glBlendFunc(srcFactor, destFactor);
+}
+
+void GLRenderBackend::bindTexture(GLuint texture)
+{
+	glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void GLRenderBackend::setColor(const Color& color)
+{
+	glColor4f(color.r, color.g, color.b, color.a);
+}
+
+void GLRenderBackend::setPointer(GLenum array, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+	switch (array) {
+	case GL_VERTEX_ARRAY:			glVertexPointer(size, type, stride, pointer); break;
+	case GL_TEXTURE_COORD_ARRAY:	glTexCoordPointer(size, type, stride, pointer); break;
+	case GL_COLOR_ARRAY:			glColorPointer(size, type, stride, pointer); break;
+	default: kuto_assert(false); break;
+	}
+}
+
+void GLRenderBackend::drawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	glDrawArrays(mode, first, count);
+}
+
+/**
+ * テクスチャ作成（作成したテクスチャはバインドされたまま）
+ * @param width			幅
+ * @param height		高さ
+ * @param format		GLフォーマット
+ * @param type			ピクセルタイプ
+ * @param data			ピクセル
+ * @param wrap			GL_CLAMP_TO_EDGE / GL_REPEAT
+ * @return				テクスチャ名
+ */
+GLuint GLRenderBackend::createTexture(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data, GLenum wrap)
+{
+	GLuint texture = 0;
+	glGenTextures(1, &texture);
+	kuto_assert( texture != GL_INVALID_VALUE );
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, type, data);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	return texture;
+}
+
+void GLRenderBackend::updateTexture(GLuint texture, GLint x, GLint y, GLsizei width, GLsizei height,
+		GLenum format, GLenum type, const GLvoid* data)
+{
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, type, data);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+void GLRenderBackend::deleteTexture(GLuint texture)
+{
+	glDeleteTextures(1, &texture);
+}
+
+}	// namespace kuto
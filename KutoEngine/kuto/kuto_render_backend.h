@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @brief Render Backend
+ * @author project.kuto
+ */
+#pragma once
+
+#include "kuto_gl.h"
+#include "kuto_math.h"
+
+
+namespace kuto {
+
+/// what GraphicsDevice draws with. redundant state changes are filtered by GraphicsDevice before they get here
+class RenderBackend
+{
+public:
+	virtual ~RenderBackend() {}
+
+	/// false when raw GL calls don't reach the screen (code using GL directly must go through GraphicsDevice)
+	virtual bool directGL() const = 0;
+
+	virtual void clear(const Color& color) = 0;
+	virtual void setMatrixMode(GLenum mode) = 0;
+	virtual void loadMatrix(const Matrix& matrix) = 0;
+	virtual void setViewport(const Viewport& viewport) = 0;
+	virtual void setClientState(GLenum state, bool enable) = 0;
+	virtual void setEnable(GLenum state, bool enable) = 0;
+	virtual void setBlendFunc(GLenum srcFactor, GLenum destFactor) = 0;
+	virtual void bindTexture(GLuint texture) = 0;
+	virtual void setColor(const Color& color) = 0;
+	/// array is GL_VERTEX_ARRAY, GL_TEXTURE_COORD_ARRAY or GL_COLOR_ARRAY
+	virtual void setPointer(GLenum array, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer) = 0;
+	virtual void drawArrays(GLenum mode, GLint first, GLsizei count) = 0;
+
+	/// returns the texture name. wrap is GL_CLAMP_TO_EDGE or GL_REPEAT, the pixels are tightly packed
+	virtual GLuint createTexture(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data, GLenum wrap) = 0;
+	virtual void updateTexture(GLuint texture, GLint x, GLint y, GLsizei width, GLsizei height
+	, GLenum format, GLenum type, const GLvoid* data) = 0;
+	virtual void deleteTexture(GLuint texture) = 0;
+};	// class RenderBackend
+
+/// OpenGL (ES1) backend
+class GLRenderBackend : public RenderBackend
+{
+public:
+	virtual bool directGL() const { return true; }
+
+	virtual void clear(const Color& color);
+	virtual void setMatrixMode(GLenum mode);
+	virtual void loadMatrix(const Matrix& matrix);
+	virtual void setViewport(const Viewport& viewport);
+	virtual void setClientState(GLenum state, bool enable);
+	virtual void setEnable(GLenum state, bool enable);
+	virtual void setBlendFunc(GLenum srcFactor, GLenum destFactor);
+	virtual void bindTexture(GLuint texture);
+	virtual void setColor(const Color& color);
+	virtual void setPointer(GLenum array, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+	virtual void drawArrays(GLenum mode, GLint first, GLsizei count);
+
+	virtual GLuint createTexture(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data, GLenum wrap);
+	virtual void updateTexture(GLuint texture, GLint x, GLint y, GLsizei width, GLsizei height
+	, GLenum format, GLenum type, const GLvoid* data);
+	virtual void deleteTexture(GLuint texture);
+};	// class GLRenderBackend
+
+}	// namespace kuto
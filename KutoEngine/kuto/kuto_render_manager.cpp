@@ -56,6 +56,7 @@ void RenderManager::render()
 	for (u32 layerIndex = 0; layerIndex < layers_.size(); layerIndex++) {
 		currentLayer_ = Layer::Type(layerIndex);
 		layers_[layerIndex]->render();
+		graphics2D_->flush();
 	}
 	GraphicsDevice::instance().endRender();
 }
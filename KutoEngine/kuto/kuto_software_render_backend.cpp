@@ -0,0 +1,412 @@
+/**
+ * @file
+ * @brief Software Render Backend
+ * @author project.kuto
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <png.h>
+#include "kuto_software_render_backend.h"
+#include "kuto_error.h"
+#include "kuto_utility.h"
+
+
+namespace
+{
+	inline kuto::u8 expand5(unsigned c) { return (c << 3) | (c >> 2); }
+	inline kuto::u8 expand6(unsigned c) { return (c << 2) | (c >> 4); }
+	inline kuto::u8 toByte(float c) { return kuto::u8(kuto::clamp(c, 0.f, 1.f) * 255.f + 0.5f); }
+
+	int pixelSize(GLenum format, GLenum type)
+	{
+		if (type != GL_UNSIGNED_BYTE)
+			return 2;		// packed 16 bit
+		switch (format) {
+		case GL_RGBA:				return 4;
+		case GL_RGB:				return 3;
+		case GL_LUMINANCE_ALPHA:	return 2;
+		default:					return 1;
+		}
+	}
+
+	/// converts count tightly packed GL pixels to RGBA
+	void toRGBA(kuto::u8* dst, const kuto::u8* src, int count, GLenum format, GLenum type)
+	{
+		for (int i = 0; i < count; i++, dst += 4) {
+			if (type == GL_UNSIGNED_BYTE) {
+				switch (format) {
+				case GL_RGBA:				dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = src[3]; break;
+				case GL_RGB:				dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 0xff; break;
+				case GL_ALPHA:				dst[0] = dst[1] = dst[2] = 0xff; dst[3] = src[0]; break;
+				case GL_LUMINANCE:			dst[0] = dst[1] = dst[2] = src[0]; dst[3] = 0xff; break;
+				case GL_LUMINANCE_ALPHA:	dst[0] = dst[1] = dst[2] = src[0]; dst[3] = src[1]; break;
+				default: kuto_assert(false); break;
+				}
+			} else {
+				kuto::u16 p;
+				std::memcpy(&p, src, sizeof(p));
+				switch (type) {
+				case GL_UNSIGNED_SHORT_5_6_5:
+					dst[0] = expand5(p >> 11); dst[1] = expand6((p >> 5) & 0x3f); dst[2] = expand5(p & 0x1f); dst[3] = 0xff;
+					break;
+				case GL_UNSIGNED_SHORT_5_5_5_1:
+					dst[0] = expand5(p >> 11); dst[1] = expand5((p >> 6) & 0x1f); dst[2] = expand5((p >> 1) & 0x1f);
+					dst[3] = (p & 1)? 0xff : 0x00;
+					break;
+				case GL_UNSIGNED_SHORT_4_4_4_4:
+					dst[0] = (p >> 12) * 0x11; dst[1] = ((p >> 8) & 0xf) * 0x11; dst[2] = ((p >> 4) & 0xf) * 0x11; dst[3] = (p & 0xf) * 0x11;
+					break;
+				default: kuto_assert(false); break;
+				}
+			}
+			src += pixelSize(format, type);
+		}
+	}
+
+	template<class T>
+	inline float edgeFunction(const T& a, const T& b, float x, float y)
+	{
+		return (b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x);
+	}
+	/// pixels exactly on a top or left edge belong to the triangle, so quads sharing an edge don't blend it twice
+	template<class T>
+	inline bool isTopLeft(const T& a, const T& b)
+	{
+		return (a.y == b.y && b.x > a.x) || b.y < a.y;
+	}
+	inline bool inside(float w, bool topLeft) { return w > 0.f || (w == 0.f && topLeft); }
+
+	float blendFactor(GLenum factor, float srcC, float srcA, float dstC, float dstA)
+	{
+		switch (factor) {
+		case GL_ZERO:					return 0.f;
+		case GL_ONE:					return 1.f;
+		case GL_SRC_COLOR:				return srcC;
+		case GL_ONE_MINUS_SRC_COLOR:	return 1.f - srcC;
+		case GL_SRC_ALPHA:				return srcA;
+		case GL_ONE_MINUS_SRC_ALPHA:	return 1.f - srcA;
+		case GL_DST_COLOR:				return dstC;
+		case GL_ONE_MINUS_DST_COLOR:	return 1.f - dstC;
+		case GL_DST_ALPHA:				return dstA;
+		case GL_ONE_MINUS_DST_ALPHA:	return 1.f - dstA;
+		default: kuto_assert(false);	return 1.f;
+		}
+	}
+}	// namespace
+
+
+namespace kuto {
+
+SoftwareRenderBackend::SoftwareRenderBackend(int width, int height)
+: width_(width), height_(height), frameBuffer_(width * height * 4, 0)
+, nextTexture_(1), bindTexture_(0), matrixMode_(GL_MODELVIEW)
+, viewport_(0.f, 0.f, width, height)
+, enableVertex_(false), enableTexcoord_(false), enableColor_(false)
+, enableBlend_(false), enableTexture2D_(false)
+, blendSrcFactor_(GL_ONE), blendDestFactor_(GL_ZERO)
+, color_(1.f, 1.f, 1.f, 1.f)
+{
+	projection_.identity();
+	model_.identity();
+	Pointer const none = { 0, GL_FLOAT, 0, NULL };
+	vertexPointer_ = texcoordPointer_ = colorPointer_ = none;
+}
+
+void SoftwareRenderBackend::clear(const Color& color)
+{
+	u8 const c[4] = { toByte(color.r), toByte(color.g), toByte(color.b), toByte(color.a) };
+	for (std::size_t i = 0; i < frameBuffer_.size(); i += 4)
+		std::memcpy(&frameBuffer_[i], c, sizeof(c));
+}
+
+void SoftwareRenderBackend::setMatrixMode(GLenum mode)
+{
+	matrixMode_ = mode;
+}
+
+void SoftwareRenderBackend::loadMatrix(const Matrix& matrix)
+{
+	if (matrixMode_ == GL_PROJECTION)
+		projection_ = matrix;
+	else if (matrixMode_ == GL_MODELVIEW)
+		model_ = matrix;
+}
+
+void SoftwareRenderBackend::setViewport(const Viewport& viewport)
+{
+	viewport_ = viewport;
+}
+
+void SoftwareRenderBackend::setClientState(GLenum state, bool enable)
+{
+	switch (state) {
+	case GL_VERTEX_ARRAY:			enableVertex_ = enable; break;
+	case GL_TEXTURE_COORD_ARRAY:	enableTexcoord_ = enable; break;
+	case GL_COLOR_ARRAY:			enableColor_ = enable; break;
+	default: break;
+	}
+}
+
+void SoftwareRenderBackend::setEnable(GLenum state, bool enable)
+{
+	switch (state) {
+	case GL_BLEND:					enableBlend_ = enable; break;
+	case GL_TEXTURE_2D:				enableTexture2D_ = enable; break;
+	default: break;
+	}
+}
+
+void SoftwareRenderBackend::setBlendFunc(GLenum srcFactor, GLenum destFactor)
+{
+	blendSrcFactor_ = srcFactor;
+	blendDestFactor_ = destFactor;
+}
+
+void SoftwareRenderBackend::bindTexture(GLuint texture)
+{
+	bindTexture_ = texture;
+}
+
+void SoftwareRenderBackend::setColor(const Color& color)
+{
+	color_ = color;
+}
+
+void SoftwareRenderBackend::setPointer(GLenum array, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+	Pointer const p = { size, type, stride, pointer };
+	switch (array) {
+	case GL_VERTEX_ARRAY:			vertexPointer_ = p; break;
+	case GL_TEXTURE_COORD_ARRAY:	texcoordPointer_ = p; break;
+	case GL_COLOR_ARRAY:			colorPointer_ = p; break;
+	default: kuto_assert(false); break;
+	}
+}
+
+void SoftwareRenderBackend::drawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	if (!enableVertex_)
+		return;
+	Matrix const transform = model_ * projection_;
+	GLint const end = first + count;
+	switch (mode) {
+	case GL_TRIANGLES:
+		for (GLint i = first; i + 2 < end; i += 3)
+			drawTriangle(screenVertex(i, transform), screenVertex(i + 1, transform), screenVertex(i + 2, transform));
+		break;
+	case GL_TRIANGLE_STRIP:
+		for (GLint i = first; i + 2 < end; i++)
+			drawTriangle(screenVertex(i, transform), screenVertex(i + 1, transform), screenVertex(i + 2, transform));
+		break;
+	case GL_TRIANGLE_FAN:
+		for (GLint i = first + 1; i + 1 < end; i++)
+			drawTriangle(screenVertex(first, transform), screenVertex(i, transform), screenVertex(i + 1, transform));
+		break;
+	default:		// points and lines aren't drawn by the 2D renderer
+		break;
+	}
+}
+
+/**
+ * テクスチャ作成
+ * @param width			幅
+ * @param height		高さ
+ * @param format		GLフォーマット
+ * @param type			ピクセルタイプ
+ * @param data			ピクセル（NULLなら透明）
+ * @param wrap			GL_CLAMP_TO_EDGE / GL_REPEAT
+ * @return				テクスチャ名
+ */
+GLuint SoftwareRenderBackend::createTexture(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data, GLenum wrap)
+{
+	GLuint const texture = nextTexture_++;
+	Image& image = images_[texture];
+	image.width = width;
+	image.height = height;
+	image.wrap = wrap;
+	image.pixels.assign(width * height * 4, 0);
+	if (data)
+		updateTexture(texture, 0, 0, width, height, format, type, data);
+	bindTexture_ = texture;
+	return texture;
+}
+
+void SoftwareRenderBackend::updateTexture(GLuint texture, GLint x, GLint y, GLsizei width, GLsizei height,
+		GLenum format, GLenum type, const GLvoid* data)
+{
+	ImageMap::iterator it = images_.find(texture);
+	kuto_assert(it != images_.end());
+	Image& image = it->second;
+	kuto_assert(x >= 0 && y >= 0 && x + width <= image.width && y + height <= image.height);
+
+	int const pitch = width * pixelSize(format, type);
+	const u8* src = static_cast<const u8*>(data);
+	for (int row = 0; row < height; row++) {
+		toRGBA(&image.pixels[((y + row) * image.width + x) * 4], src + row * pitch, width, format, type);
+	}
+	bindTexture_ = texture;
+}
+
+void SoftwareRenderBackend::deleteTexture(GLuint texture)
+{
+	images_.erase(texture);
+}
+
+/**
+ * 頂点をフレームバッファ上の座標に変換
+ * @param index			頂点番号
+ * @param transform		モデル行列 * 射影行列
+ */
+SoftwareRenderBackend::ScreenVertex SoftwareRenderBackend::screenVertex(int index, const Matrix& transform) const
+{
+	ScreenVertex ret;
+
+	kuto_assert(vertexPointer_.type == GL_FLOAT);
+	GLsizei const vertexStride = vertexPointer_.stride? vertexPointer_.stride : vertexPointer_.size * sizeof(GLfloat);
+	const GLfloat* p = reinterpret_cast<const GLfloat*>(static_cast<const u8*>(vertexPointer_.pointer) + index * vertexStride);
+	float const x = p[0], y = p[1], z = (vertexPointer_.size > 2)? p[2] : 0.f;
+	const float* m = transform.pointer();
+	float const cx = x * m[0] + y * m[4] + z * m[8]  + m[12];
+	float const cy = x * m[1] + y * m[5] + z * m[9]  + m[13];
+	float const cw = x * m[3] + y * m[7] + z * m[11] + m[15];
+	// GL window coordinates are bottom up
+	ret.x = viewport_.x + (cx / cw + 1.f) * 0.5f * viewport_.width;
+	ret.y = height_ - (viewport_.y + (cy / cw + 1.f) * 0.5f * viewport_.height);
+
+	if (enableTexcoord_ && texcoordPointer_.pointer) {
+		kuto_assert(texcoordPointer_.type == GL_FLOAT);
+		GLsizei const stride = texcoordPointer_.stride? texcoordPointer_.stride : texcoordPointer_.size * sizeof(GLfloat);
+		const GLfloat* t = reinterpret_cast<const GLfloat*>(static_cast<const u8*>(texcoordPointer_.pointer) + index * stride);
+		ret.u = t[0];
+		ret.v = t[1];
+	} else {
+		ret.u = ret.v = 0.f;
+	}
+
+	if (enableColor_ && colorPointer_.pointer) {
+		if (colorPointer_.type == GL_UNSIGNED_BYTE) {
+			GLsizei const stride = colorPointer_.stride? colorPointer_.stride : colorPointer_.size;
+			const u8* c = static_cast<const u8*>(colorPointer_.pointer) + index * stride;
+			ret.color.set(c[0] / 255.f, c[1] / 255.f, c[2] / 255.f, c[3] / 255.f);
+		} else {
+			kuto_assert(colorPointer_.type == GL_FLOAT);
+			GLsizei const stride = colorPointer_.stride? colorPointer_.stride : colorPointer_.size * sizeof(GLfloat);
+			const GLfloat* c = reinterpret_cast<const GLfloat*>(static_cast<const u8*>(colorPointer_.pointer) + index * stride);
+			ret.color.set(c[0], c[1], c[2], c[3]);
+		}
+	} else {
+		ret.color = color_;
+	}
+	return ret;
+}
+
+void SoftwareRenderBackend::drawTriangle(const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2)
+{
+	const ScreenVertex* a = &v0;
+	const ScreenVertex* b = &v1;
+	const ScreenVertex* c = &v2;
+	float area = edgeFunction(*a, *b, c->x, c->y);
+	if (area == 0.f)
+		return;
+	if (area < 0.f) {		// no culling, turn everything clockwise
+		std::swap(b, c);
+		area = -area;
+	}
+
+	const Image* image = NULL;
+	if (enableTexture2D_ && enableTexcoord_) {
+		ImageMap::const_iterator it = images_.find(bindTexture_);
+		if (it != images_.end())
+			image = &it->second;
+	}
+
+	int const minX = std::max(0, (int)std::floor(std::min(a->x, std::min(b->x, c->x))));
+	int const maxX = std::min(width_ - 1, (int)std::ceil(std::max(a->x, std::max(b->x, c->x))));
+	int const minY = std::max(0, (int)std::floor(std::min(a->y, std::min(b->y, c->y))));
+	int const maxY = std::min(height_ - 1, (int)std::ceil(std::max(a->y, std::max(b->y, c->y))));
+	bool const topLeftA = isTopLeft(*b, *c), topLeftB = isTopLeft(*c, *a), topLeftC = isTopLeft(*a, *b);
+	float const invArea = 1.f / area;
+
+	for (int py = minY; py <= maxY; py++) {
+		float const y = py + 0.5f;
+		for (int px = minX; px <= maxX; px++) {
+			float const x = px + 0.5f;
+			float const wa = edgeFunction(*b, *c, x, y);
+			float const wb = edgeFunction(*c, *a, x, y);
+			float const wc = edgeFunction(*a, *b, x, y);
+			if (!inside(wa, topLeftA) || !inside(wb, topLeftB) || !inside(wc, topLeftC))
+				continue;
+
+			float const la = wa * invArea, lb = wb * invArea, lc = wc * invArea;
+			Color color = a->color * la + b->color * lb + c->color * lc;
+			if (image)		// GL_MODULATE
+				color *= sample(*image, a->u * la + b->u * lb + c->u * lc, a->v * la + b->v * lb + c->v * lc);
+			blend(&frameBuffer_[(py * width_ + px) * 4], color);
+		}
+	}
+}
+
+Color SoftwareRenderBackend::sample(const Image& image, float u, float v) const
+{
+	int tx = (int)std::floor(u * image.width);
+	int ty = (int)std::floor(v * image.height);
+	if (image.wrap == GL_REPEAT) {
+		tx %= image.width;	if (tx < 0) tx += image.width;
+		ty %= image.height;	if (ty < 0) ty += image.height;
+	} else {
+		tx = clamp(tx, 0, image.width - 1);
+		ty = clamp(ty, 0, image.height - 1);
+	}
+	const u8* p = &image.pixels[(ty * image.width + tx) * 4];
+	return Color(p[0] / 255.f, p[1] / 255.f, p[2] / 255.f, p[3] / 255.f);
+}
+
+void SoftwareRenderBackend::blend(u8* dst, const Color& src) const
+{
+	if (!enableBlend_) {
+		dst[0] = toByte(src.r); dst[1] = toByte(src.g); dst[2] = toByte(src.b); dst[3] = toByte(src.a);
+		return;
+	}
+	float const srcC[4] = { clamp(src.r, 0.f, 1.f), clamp(src.g, 0.f, 1.f), clamp(src.b, 0.f, 1.f), clamp(src.a, 0.f, 1.f) };
+	float const dstA = dst[3] / 255.f;
+	for (int i = 0; i < 4; i++) {
+		float const dstC = dst[i] / 255.f;
+		float const s = blendFactor(blendSrcFactor_, srcC[i], srcC[3], dstC, dstA);
+		float const d = blendFactor(blendDestFactor_, srcC[i], srcC[3], dstC, dstA);
+		dst[i] = toByte(srcC[i] * s + dstC * d);
+	}
+}
+
+/**
+ * フレームバッファをPNGで保存
+ * @param filename		ファイル名
+ * @retval true			成功
+ */
+bool SoftwareRenderBackend::writePNG(const char* filename) const
+{
+	FILE* fp = std::fopen(filename, "wb");
+	if (!fp)
+		return false;
+	png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	png_infop info = png ? png_create_info_struct(png) : NULL;
+	if (!info || setjmp(png_jmpbuf(png))) {
+		png_destroy_write_struct(&png, info ? &info : NULL);
+		std::fclose(fp);
+		return false;
+	}
+	png_init_io(png, fp);
+	png_set_IHDR(png, info, width_, height_, 8, PNG_COLOR_TYPE_RGB_ALPHA
+	, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+	png_write_info(png, info);
+	for (int y = 0; y < height_; y++)
+		png_write_row(png, const_cast<png_bytep>(&frameBuffer_[y * width_ * 4]));
+	png_write_end(png, info);
+	png_destroy_write_struct(&png, &info);
+	std::fclose(fp);
+	return true;
+}
+
+}	// namespace kuto
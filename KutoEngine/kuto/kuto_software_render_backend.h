@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @brief Software Render Backend
+ * @author project.kuto
+ */
+#pragma once
+
+#include <vector>
+#include <boost/unordered_map.hpp>
+#include "kuto_render_backend.h"
+#include "kuto_types.h"
+
+
+namespace kuto {
+
+/// rasterizes into memory without GL (for machines without a GPU or a display)
+/// textures are sampled nearest with GL_MODULATE. there is no depth buffer
+class SoftwareRenderBackend : public RenderBackend
+{
+public:
+	SoftwareRenderBackend(int width, int height);
+
+	virtual bool directGL() const { return false; }
+
+	virtual void clear(const Color& color);
+	virtual void setMatrixMode(GLenum mode);
+	virtual void loadMatrix(const Matrix& matrix);
+	virtual void setViewport(const Viewport& viewport);
+	virtual void setClientState(GLenum state, bool enable);
+	virtual void setEnable(GLenum state, bool enable);
+	virtual void setBlendFunc(GLenum srcFactor, GLenum destFactor);
+	virtual void bindTexture(GLuint texture);
+	virtual void setColor(const Color& color);
+	virtual void setPointer(GLenum array, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+	virtual void drawArrays(GLenum mode, GLint first, GLsizei count);
+
+	virtual GLuint createTexture(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data, GLenum wrap);
+	virtual void updateTexture(GLuint texture, GLint x, GLint y, GLsizei width, GLsizei height
+	, GLenum format, GLenum type, const GLvoid* data);
+	virtual void deleteTexture(GLuint texture);
+
+	int width() const { return width_; }
+	int height() const { return height_; }
+	/// RGBA 8 bit each, top row first
+	const u8* frameBuffer() const { return &frameBuffer_[0]; }
+	bool writePNG(const char* filename) const;
+
+private:
+	struct Image
+	{
+		int					width;
+		int					height;
+		GLenum				wrap;
+		std::vector<u8>		pixels;		///< RGBA, top row first
+	};
+	struct Pointer
+	{
+		GLint			size;
+		GLenum			type;
+		GLsizei			stride;
+		const GLvoid*	pointer;
+	};
+	struct ScreenVertex
+	{
+		float			x, y;		///< pixels from the top left of the frame buffer
+		float			u, v;
+		Color			color;
+	};
+	typedef boost::unordered_map<GLuint, Image> ImageMap;
+
+	ScreenVertex screenVertex(int index, const Matrix& transform) const;
+	void drawTriangle(const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2);
+	Color sample(const Image& image, float u, float v) const;
+	void blend(u8* dst, const Color& src) const;
+
+private:
+	int					width_;
+	int					height_;
+	std::vector<u8>		frameBuffer_;
+	ImageMap			images_;			///< texture name -> pixels
+	GLuint				nextTexture_;
+	GLuint				bindTexture_;
+	GLenum				matrixMode_;
+	Matrix				projection_;
+	Matrix				model_;
+	Viewport			viewport_;
+	bool				enableVertex_;
+	bool				enableTexcoord_;
+	bool				enableColor_;
+	bool				enableBlend_;
+	bool				enableTexture2D_;
+	GLenum				blendSrcFactor_;
+	GLenum				blendDestFactor_;
+	Color				color_;
+	Pointer				vertexPointer_;
+	Pointer				texcoordPointer_;
+	Pointer				colorPointer_;
+};	// class SoftwareRenderBackend
+
+}	// namespace kuto
@@ -16,7 +16,7 @@ namespace kuto {
 
 Texture::Texture()
 : name_(GL_INVALID_VALUE), data_(NULL)
-, width_(0), height_(0), orgWidth_(0), orgHeight_(0), format_(GL_RGB)
+, width_(0), height_(0), orgWidth_(0), orgHeight_(0), format_(GL_RGB), type_(GL_UNSIGNED_BYTE)
 , created_(false)
 {
 }
@@ -30,7 +30,7 @@ void Texture::destroy()
 {
 	if (created_) {
 		if (name_ != GL_INVALID_VALUE) {
-			glDeleteTextures(1, &name_);
+			GraphicsDevice::instance().deleteTexture(name_);
 		}
 		if (data_) {
 			delete[] data_;
@@ -42,10 +42,31 @@ void Texture::destroy()
 	data_ = NULL;
 }
 
-bool Texture::loadFromFile(const char* filename, bool useAlphaPalette, int hue)
+bool Texture::loadFromFile(const char* filename, bool useAlphaPalette, int hue, bool async, bool keepData)
 {
-	bool ret = handle_.load(filename, useAlphaPalette, hue);
+	bool ret = handle_.load(filename, useAlphaPalette, hue, async, keepData);
+	if (handle_.isReady())
+		attachHandle();
+	return ret;
+}
+
+bool Texture::isReady()
+{
+	if (!created_ && !isValid() && handle_.isReady())
+		attachHandle();
+	return created_ || handle_.isReady();
+}
 
+void Texture::wait()
+{
+	if (created_ || isValid())
+		return;
+	handle_.wait();
+	attachHandle();
+}
+
+void Texture::attachHandle()
+{
 	name_ = handle_.glTexture();
 	data_ = handle_.data();
 	width_ = handle_.width();
@@ -53,7 +74,7 @@ bool Texture::loadFromFile(const char* filename, bool useAlphaPalette, int hue)
 	orgWidth_ = handle_.orgWidth();
 	orgHeight_ = handle_.orgHeight();
 	format_ = handle_.format();
-	return ret;
+	type_ = handle_.type();
 }
 
 bool Texture::loadFromMemory(char* data, int width, int height, int orgWidth, int orgHeight, GLenum format)
@@ -64,6 +85,7 @@ bool Texture::loadFromMemory(char* data, int width, int height, int orgWidth, in
 	orgWidth_ = orgWidth;
 	orgHeight_ = orgHeight;
 	format_ = format;
+	type_ = GL_UNSIGNED_BYTE;
 
 	return createGLTexture();
 }
@@ -71,21 +93,15 @@ bool Texture::loadFromMemory(char* data, int width, int height, int orgWidth, in
 bool Texture::createGLTexture()
 {
 	created_ = true;
-	glGenTextures(1, &name_);
+	name_ = GraphicsDevice::instance().createTexture(width_, height_, format_, type_, data_, GL_CLAMP_TO_EDGE);
 	kuto_assert( name_ != GL_INVALID_VALUE );
-	GraphicsDevice::instance().setTexture2D(true, name_);
-	glTexImage2D(GL_TEXTURE_2D, 0, format_, width_, height_, 0, format_, GL_UNSIGNED_BYTE, data_);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	return true;
 }
 
 void Texture::updateImage()
 {
-	GraphicsDevice::instance().setTexture2D(true, name_);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width_, height_, format_, GL_UNSIGNED_BYTE, data_);
+	kuto_assert(data_);		// loaded from a file without keepData
+	GraphicsDevice::instance().updateTexture(name_, 0, 0, width_, height_, format_, type_, data_);
 }
 
 }	// namespace kuto
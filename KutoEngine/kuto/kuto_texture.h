@@ -17,7 +17,11 @@ public:
 	Texture();
 	~Texture();
 
-	bool loadFromFile(const char* filename, bool useAlphaPalette = false, int hue = 0);
+	/// asynchronous loads become valid once isReady() returns true or wait() is called
+	/// data() is only kept after the upload with keepData
+	bool loadFromFile(const char* filename, bool useAlphaPalette = false, int hue = 0, bool async = false, bool keepData = false);
+	bool isReady();
+	void wait();
 	bool loadFromMemory(char* data, int width, int height) {
 		return loadFromMemory(data, width, height, width, height, GL_RGBA);
 	}
@@ -33,10 +37,12 @@ public:
 	const char* data() const { return data_; }
 	char* data() { return data_; }
 	GLenum format() const { return format_; }
+	GLenum type() const { return type_; }
 	void updateImage();
 
 private:
 	bool createGLTexture();
+	void attachHandle();
 
 private:
 	LoadTextureHandle	handle_;		///< Load Handle
@@ -47,6 +53,7 @@ private:
 	int					orgWidth_;		///< original texture width
 	int					orgHeight_;		///< original texture height
 	GLenum				format_;		///< OpenGL texture format
+	GLenum				type_;			///< OpenGL pixel type
 	bool				created_;		///< create flag
 };	// class Texture
 
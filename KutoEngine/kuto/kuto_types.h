@@ -15,6 +15,16 @@
 
 // #include "kuto_define.h"
 
+// decode asynchronous loads on a worker thread. without it they're decoded one a frame
+// (checks the compiler's macros directly, rpg2k/Config.hpp may not be included yet)
+#if !defined(KUTO_LOAD_THREAD)
+	#if defined(WIN32) || defined(_WIN32)
+		#define KUTO_LOAD_THREAD 0
+	#else
+		#define KUTO_LOAD_THREAD 1
+	#endif
+#endif
+
 namespace kuto
 {
 	typedef int8_t  s8 ;
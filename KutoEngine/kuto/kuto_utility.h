@@ -8,6 +8,7 @@
 #include <string>
 #include <cstdlib>
 #include <ctime>
+#include "kuto_random.h"
 #include "kuto_types.h"
 
 
@@ -24,14 +25,12 @@ namespace kuto {
 	std::string sjis2utf8(const std::string& str);
 	std::string utf82sjis(const std::string& str);
 
-	inline int rand() { return std::rand(); }
-	inline void randomize() { std::srand((u32)time(NULL)); }
-	inline float random(float max) { return ((float)(rand() % 100000) / 100000.f) * max; }
-	inline int random(int max) { return rand() % max; }
-	inline uint random(uint max) { return rand() % max; }
-
 	u32 crc32(const char* data, u32 size);
 	inline u32 crc32(const std::string& data) { return crc32(data.c_str(), data.size()); }
 
 	int fixPowerOfTwo(int value);
+
+	/// texels for GL_UNSIGNED_SHORT_5_6_5 / GL_UNSIGNED_SHORT_5_5_5_1
+	inline u16 packRGB565(u8 r, u8 g, u8 b) { return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3); }
+	inline u16 packRGBA5551(u8 r, u8 g, u8 b, bool opaque) { return ((r >> 3) << 11) | ((g >> 3) << 6) | ((b >> 3) << 1) | (opaque? 1 : 0); }
 }
@@ -9,13 +9,13 @@
 
 namespace kuto {
 
-class LoadTextureCore;
+struct IndexedImage;
 
 
 class XyzLoader
 {
 public:
-	bool createTexture(char* bytes, LoadTextureCore& core, bool useAlphaPalette, int hue);
+	bool decodeIndexed(char* bytes, IndexedImage& image);
 
 private:
 	static const int BIT_DEPTH = 8;
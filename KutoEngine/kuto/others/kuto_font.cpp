@@ -4,7 +4,6 @@
  * @author project.kuto
  */
 
-#include <kuto/kuto_array.h>
 #include <kuto/kuto_font.h>
 #include <kuto/kuto_gl.h>
 #include <kuto/kuto_graphics_device.h>
@@ -14,8 +13,9 @@
 
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
 
-#include <stdexcept>
+#include <cstring>
 #include <vector>
 
 #include <ft2build.h>
@@ -49,8 +49,10 @@ namespace
 		 1,  1, // RightBottom
 	};
 
-	const int FONT_TEXTURE_WIDTH = 1024;
-	const int FONT_TEXTURE_HEIGHT = 32;
+	const int FONT_TEXTURE_WIDTH = 512;		///< glyph atlas page size
+	const int FONT_TEXTURE_HEIGHT = 512;
+	const int FONT_CELL_HEIGHT = 32;		///< every glyph is rasterized into a cell this high
+	const int FONT_CELL_PADDING = 1;		///< blank texels around a cell so filtering doesn't bleed
 	const float FONT_BASE_SIZE = 24.0f;
 	char const* FONT_NAME[] = {
 		"IPAfont00302/ipag.ttf", // gothic
@@ -61,47 +63,59 @@ namespace
 	{
 		u32			code;
 		float		width;
-		float		x;
+		float		height;
+		float		x;			///< cell position in the page
+		float		y;
 		GLint		texture;
 	};
 
 
+	/// glyph atlas page. cells are packed in rows (shelves) of FONT_CELL_HEIGHT
 	class FontTexture
 	{
 	public:
 		FontTexture()
+		: currentX(0), currentY(0)
 		{
-			bitmapBuffer.zeromemory();
+			std::vector<uint8_t> const blank(FONT_TEXTURE_WIDTH * FONT_TEXTURE_HEIGHT, 0);
 			// generate texture
-			glGenTextures(1, &texture); kuto_assert(texture != GL_INVALID_VALUE);
-			kuto::GraphicsDevice::instance().setTexture2D(true, texture);
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT,
-				0, GL_ALPHA, GL_UNSIGNED_BYTE, &(bitmapBuffer[0]));
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			currentX = 0;
+			texture = kuto::GraphicsDevice::instance().createTexture(FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT,
+				GL_ALPHA, GL_UNSIGNED_BYTE, &blank[0]);
+			kuto_assert(texture != GL_INVALID_VALUE);
 		}
 		~FontTexture()
 		{
-			if (texture != GL_INVALID_VALUE) glDeleteTextures(1, &texture);
+			if (texture != GL_INVALID_VALUE) kuto::GraphicsDevice::instance().deleteTexture(texture);
 		}
-		void redrawTexture() {
-			// redraw texture
-			kuto::GraphicsDevice::instance().setTexture2D(true, texture);
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA
-			, FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT
-			, 0, GL_ALPHA, GL_UNSIGNED_BYTE, &(bitmapBuffer[0]));
+		/// reserves a width x FONT_CELL_HEIGHT cell. false when the page is full
+		bool allocate(int width, int& x, int& y)
+		{
+			int const cellWidth = width + FONT_CELL_PADDING * 2;
+			int const cellHeight = FONT_CELL_HEIGHT + FONT_CELL_PADDING * 2;
+			if (currentX + cellWidth > FONT_TEXTURE_WIDTH) {	// next shelf
+				currentX = 0;
+				currentY += cellHeight;
+			}
+			if (currentY + cellHeight > FONT_TEXTURE_HEIGHT)
+				return false;
+			x = currentX + FONT_CELL_PADDING;
+			y = currentY + FONT_CELL_PADDING;
+			currentX += cellWidth;
+			return true;
+		}
+		/// uploads only the cell (with its padding)
+		void updateCell(int x, int y, int width, const std::vector<uint8_t>& bitmap)
+		{
+			kuto::GraphicsDevice::instance().updateTexture(texture
+			, x - FONT_CELL_PADDING, y - FONT_CELL_PADDING
+			, width + FONT_CELL_PADDING * 2, FONT_CELL_HEIGHT + FONT_CELL_PADDING * 2
+			, GL_ALPHA, GL_UNSIGNED_BYTE, &bitmap[0]);
 		}
 
 	public:
-		kuto::Array<uint8_t, FONT_TEXTURE_WIDTH * FONT_TEXTURE_HEIGHT>	bitmapBuffer;
 		GLuint 					texture;
-		std::vector<FontInfo>	fontInfoList;
 		int						currentX;
-		u32						minCode;
-		u32						maxCode;
+		int						currentY;
 	};
 
 
@@ -130,19 +144,18 @@ namespace
 		};
 	public:
 		FontImageCreater(Font::Type const type)
-		: currentTexture_(-1), face_( new Face(FONT_NAME[type]) )
+		: face_( new Face(FONT_NAME[type]) )
 		{
 		}
 		FontImageCreater(FontImageCreater const& src)
-		: textureList_(src.textureList_)
-		, currentTexture_(src.currentTexture_), face_(src.face_)
+		: textureList_(src.textureList_), fontInfoMap_(src.fontInfoMap_)
+		, face_(src.face_)
 		{
 		}
 
-		void drawTextCode(u32 code, const kuto::Vector2& position, const kuto::Color& color)
+		/// rasterizes the glyph into a padded cell bitmap
+		void drawTextCode(u32 code, int cellWidth, std::vector<uint8_t>& bitmap)
 		{
-			FontTexture& fontTexture = textureList_[currentTexture_];
-
 			if( FT_Set_Pixel_Sizes((*face_), FONT_BASE_SIZE, FONT_BASE_SIZE) != 0 ) kuto_assert(false);
 			if( FT_Select_Charmap((*face_), FT_ENCODING_UNICODE) != 0 ) kuto_assert(false);
 
@@ -158,20 +171,22 @@ namespace
 
 			FT_BitmapGlyph glyph = (FT_BitmapGlyph)glyph_normal;
 
+			int const pitch = cellWidth + FONT_CELL_PADDING * 2;
+			bitmap.assign(pitch * (FONT_CELL_HEIGHT + FONT_CELL_PADDING * 2), 0);
 			int offsetX = glyph->left, offsetY = FONT_BASE_SIZE - glyph->top;
 
-			for (int y = 0; y < glyph->bitmap.rows; y++) {
-				for (int x = 0; x < glyph->bitmap.width; x++) {
-					unsigned int pixel =
-						((fontTexture.currentX + offsetX + x) + (offsetY + y) * FONT_TEXTURE_WIDTH);
-					if( pixel >= fontTexture.bitmapBuffer.size() ) continue;
-					fontTexture.bitmapBuffer[pixel] = glyph->bitmap.buffer[x + y * glyph->bitmap.width];
+			for (int y = 0; y < int(glyph->bitmap.rows); y++) {
+				int const cellY = offsetY + y;
+				if (cellY < 0 || cellY >= FONT_CELL_HEIGHT) continue;
+				for (int x = 0; x < int(glyph->bitmap.width); x++) {
+					int const cellX = offsetX + x;
+					if (cellX < 0 || cellX >= cellWidth) continue;
+					bitmap[(cellX + FONT_CELL_PADDING) + (cellY + FONT_CELL_PADDING) * pitch] =
+						glyph->bitmap.buffer[x + y * glyph->bitmap.pitch];
 				}
 			}
 
 			FT_Done_Glyph(glyph_normal);
-
-			fontTexture.redrawTexture();
 		}
 
 		Vector2 textCodeSize(u32 code, float scale)
@@ -193,75 +208,60 @@ namespace
 
 		FontInfo const& fontInfo(u32 code)
 		{
-			for (uint texIndex = 0; texIndex < textureList_.size(); texIndex++) {
-				std::vector<FontInfo>& fontInfoList = textureList_[texIndex].fontInfoList;
-				for (u32 i = 0; i < fontInfoList.size(); i++) {
-					if (code == fontInfoList[i].code) {
-						return fontInfoList[i];
-					}
-				}
-			}
+			FontInfoMap::const_iterator it = fontInfoMap_.find(code);
+			if (it != fontInfoMap_.end())
+				return it->second;
 
-			//int codeLen = (code & 0x80)? 3:1;
+			Vector2 const size = textCodeSize(code, 1.f);
 			FontInfo info;
 			info.code = code;
-			info.width = textCodeSize(code, 1.f).x;
-			if (textureList_.empty()
-			|| textureList_[currentTexture_].currentX + info.width > FONT_TEXTURE_WIDTH) {
+			info.width = size.x;
+			info.height = size.y;
+
+			int const cellWidth = kuto::clamp((int)(info.width + 1.5f), 1, FONT_TEXTURE_WIDTH - FONT_CELL_PADDING * 2);
+			int x = 0, y = 0;
+			if (textureList_.empty() || !textureList_.back().allocate(cellWidth, x, y)) {
 				textureList_.push_back( std::auto_ptr<FontTexture>( new FontTexture() ) );
-				currentTexture_++;
+				if (!textureList_.back().allocate(cellWidth, x, y)) kuto_assert(false);
 			}
-			FontTexture& fontTexture = textureList_[currentTexture_];
-			info.x = (float)fontTexture.currentX;
-			drawTextCode(code, kuto::Vector2(info.x, 0.f), kuto::Color(1.f, 1.f, 1.f, 1.f));
+			FontTexture& fontTexture = textureList_.back();
+			drawTextCode(code, cellWidth, bitmap_);
+			fontTexture.updateCell(x, y, cellWidth, bitmap_);
+			info.x = (float)x;
+			info.y = (float)y;
 			info.texture = fontTexture.texture;
-			fontTexture.fontInfoList.push_back(info);
-			fontTexture.currentX += (int)(info.width + 1.5f);
-			return fontTexture.fontInfoList.back();
+			return fontInfoMap_.insert( std::make_pair(code, info) ).first->second;
 		}
 
 	private:
-		boost::ptr_vector<FontTexture> textureList_;
-		int currentTexture_;
+		typedef boost::unordered_map<u32, FontInfo> FontInfoMap;
+
+		boost::ptr_vector<FontTexture> textureList_;	///< atlas pages. the last one gets new glyphs
+		FontInfoMap fontInfoMap_;						///< code -> glyph
+		std::vector<uint8_t> bitmap_;					///< cell rasterize buffer
 		boost::shared_ptr<Face> face_;
 	} fontImageCreater[] = { FontImageCreater(Font::GOTHIC), FontImageCreater(Font::MINCHO), };
 
+	/// decodes system strings to code points into a buffer kept between the calls
 	class Converter
 	{
-	private:
-		::iconv_t cd_;
-		static size_t const BUF_SIZE = 1024;
 	public:
-		Converter(std::string const& to, std::string const& from)
-		: cd_(NULL)
-		{
-			cd_ = ::iconv_open( to.c_str(), from.c_str() );
-			assert( cd_ != ::iconv_t(-1) );
+		Converter() : length_(0) {}
 
-			(void)(*this)("Convert test"); // skipping BOM
-		}
-		~Converter()
+		Converter const& operator()(const char* str)
 		{
-			if( ::iconv_close(cd_) != 0 ) kuto_assert(false);
+			std::size_t const len = std::strlen(str);
+			if (buffer_.size() < len) buffer_.resize(len);
+			length_ = len? rpg2k::Encode::instance().toCodePoint(str, len, &buffer_[0]) : 0;
+			return *this;
 		}
+		uint length() const { return length_; }
+		uint32_t operator[](uint i) const { return buffer_[i]; }
 
-		std::string operator()(std::string const& src) const
-			throw(std::runtime_error)
-		{
-			char buf[BUF_SIZE];
-			size_t inSize = src.size(), outSize = BUF_SIZE;
-			#if RPG2K_IS_PSP && !defined(_LIBICONV_H)
-				char const* inBuf  = src.c_str();
-			#else
-				char* inBuf  = const_cast< char* >( src.c_str() );
-			#endif
-			char* outBuf = buf;
-
-			if( ::iconv(cd_, &inBuf, &inSize, &outBuf, &outSize) == size_t(-1) ) {
-				throw std::runtime_error("convert error");
-			} else return std::string(buf, BUF_SIZE - outSize);
-		}
-	} conv_("UTF-32", rpg2k::Encode::instance().systemEncoding());
+	private:
+		std::vector<uint32_t>	buffer_;
+		uint					length_;
+	} conv_;
 } // namespace
 
 
@@ -290,21 +290,23 @@ void Font::drawText(const char* str, const Vector2& pos, const Color& color, flo
 	device.setColor(color);
 	float x = pos.x;
 	float const sizeRatio = size / FONT_BASE_SIZE;
-	std::string const strUtf32 = conv_(str);
-	for (uint i = 0; i < strUtf32.length() / sizeof(uint32_t); i++) {
-		uint32_t const code = *reinterpret_cast<uint32_t const*>( &strUtf32[sizeof(uint32_t) * i] );
+	Converter const& codes = conv_(str);
+	for (uint i = 0; i < codes.length(); i++) {
+		uint32_t const code = codes[i];
 		FontInfo const& info = fontImageCreater[type].fontInfo(code);
 		device.setTexture2D(true, info.texture);
 
-		uvs[0] = info.x / FONT_TEXTURE_WIDTH; uvs[1] = 1.f;
-		uvs[2] = info.x / FONT_TEXTURE_WIDTH; uvs[3] = 0.f;
-		uvs[4] = (info.x + info.width) / FONT_TEXTURE_WIDTH; uvs[5] = 1.f;
-		uvs[6] = (info.x + info.width) / FONT_TEXTURE_WIDTH; uvs[7] = 0.f;
+		float const u0 = info.x / FONT_TEXTURE_WIDTH, u1 = (info.x + info.width) / FONT_TEXTURE_WIDTH;
+		float const v0 = info.y / FONT_TEXTURE_HEIGHT, v1 = (info.y + FONT_CELL_HEIGHT) / FONT_TEXTURE_HEIGHT;
+		uvs[0] = u0; uvs[1] = v1;
+		uvs[2] = u0; uvs[3] = v0;
+		uvs[4] = u1; uvs[5] = v1;
+		uvs[6] = u1; uvs[7] = v0;
 
 		float aligned = ( (info.width * sizeRatio / size) > 0.55f )? size : (size * 0.5f);
 		Matrix mt, ms;
-		mt.translation(Vector3(x + (aligned - info.width * sizeRatio) * 0.5f, pos.y + FONT_TEXTURE_HEIGHT * sizeRatio, 0.f));
-		ms.scaling(Vector3(info.width * sizeRatio, FONT_TEXTURE_HEIGHT * sizeRatio, 1.f));
+		mt.translation(Vector3(x + (aligned - info.width * sizeRatio) * 0.5f, pos.y + FONT_CELL_HEIGHT * sizeRatio, 0.f));
+		ms.scaling(Vector3(info.width * sizeRatio, FONT_CELL_HEIGHT * sizeRatio, 1.f));
 		Matrix m = ms * mt;
 		device.setModelMatrix(m);
 		device.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
@@ -318,6 +320,10 @@ void Font::drawText(const char* str, const Vector2& pos, Texture& tex, uint cons
 	drawText(str, pos, Color(1.f, 1.f, 1.f, 1.f), size, type);
 #else
 	GraphicsDevice& device = GraphicsDevice::instance();
+	if (!device.directGL()) {	// the multitexture path below is raw GL
+		drawText(str, pos, Color(1.f, 1.f, 1.f, 1.f), size, type);
+		return;
+	}
 
 	static const Vector2 FONT_COLOR_S(16.f, 16.f);
 	static const int FONT_COLOR_ROW = 10;
@@ -343,17 +349,19 @@ void Font::drawText(const char* str, const Vector2& pos, Texture& tex, uint cons
 	device.setColor(color);
 	float x = pos.x;
 	float const sizeRatio = size / FONT_BASE_SIZE;
-	std::string const strUtf32 = conv_(str);
+	Converter const& codes = conv_(str);
 
 	device.setColor( Color(1.0f, 1.0f, 1.0f, 1.0f) );
 
-	for (uint i = 0; i < strUtf32.length() / sizeof(uint32_t); i++) {
-		uint32_t const code = *reinterpret_cast<uint32_t const*>( &strUtf32[sizeof(uint32_t) * i] );
+	for (uint i = 0; i < codes.length(); i++) {
+		uint32_t const code = codes[i];
 		FontInfo const& info = fontImageCreater[type].fontInfo(code);
-		texCoordFont[0] = info.x / FONT_TEXTURE_WIDTH; texCoordFont[1] = 1.f;
-		texCoordFont[2] = info.x / FONT_TEXTURE_WIDTH; texCoordFont[3] = 0.f;
-		texCoordFont[4] = (info.x + info.width) / FONT_TEXTURE_WIDTH; texCoordFont[5] = 1.f;
-		texCoordFont[6] = (info.x + info.width) / FONT_TEXTURE_WIDTH; texCoordFont[7] = 0.f;
+		float const u0 = info.x / FONT_TEXTURE_WIDTH, u1 = (info.x + info.width) / FONT_TEXTURE_WIDTH;
+		float const v0 = info.y / FONT_TEXTURE_HEIGHT, v1 = (info.y + FONT_CELL_HEIGHT) / FONT_TEXTURE_HEIGHT;
+		texCoordFont[0] = u0; texCoordFont[1] = v1;
+		texCoordFont[2] = u0; texCoordFont[3] = v0;
+		texCoordFont[4] = u1; texCoordFont[5] = v1;
+		texCoordFont[6] = u1; texCoordFont[7] = v0;
 
 		glActiveTexture(GL_TEXTURE1);
 		glBindTexture(GL_TEXTURE_2D, tex.glTexture());
@@ -374,8 +382,8 @@ void Font::drawText(const char* str, const Vector2& pos, Texture& tex, uint cons
 		float aligned = ( (info.width * sizeRatio / size) > 0.55f )? size : (size * 0.5f);
 		{
 			Matrix mt, ms;
-			mt.translation(Vector3(x + (aligned - info.width * sizeRatio) * 0.5f, pos.y + FONT_TEXTURE_HEIGHT * sizeRatio, 0.f) + Vector3(1.f, 1.f, 0.f));
-			ms.scaling(Vector3(info.width * sizeRatio, FONT_TEXTURE_HEIGHT * sizeRatio, 1.f));
+			mt.translation(Vector3(x + (aligned - info.width * sizeRatio) * 0.5f, pos.y + FONT_CELL_HEIGHT * sizeRatio, 0.f) + Vector3(1.f, 1.f, 0.f));
+			ms.scaling(Vector3(info.width * sizeRatio, FONT_CELL_HEIGHT * sizeRatio, 1.f));
 			device.setModelMatrix(ms * mt);
 		}
 		device.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
@@ -388,8 +396,8 @@ void Font::drawText(const char* str, const Vector2& pos, Texture& tex, uint cons
 		glTexCoordPointer(2, GL_FLOAT, 0, texCoordFont);
 		{
 			Matrix mt, ms;
-			mt.translation(Vector3(x, pos.y + FONT_TEXTURE_HEIGHT * sizeRatio, 0.f));
-			ms.scaling(Vector3(info.width * sizeRatio, FONT_TEXTURE_HEIGHT * sizeRatio, 1.f));
+			mt.translation(Vector3(x, pos.y + FONT_CELL_HEIGHT * sizeRatio, 0.f));
+			ms.scaling(Vector3(info.width * sizeRatio, FONT_CELL_HEIGHT * sizeRatio, 1.f));
 			device.setModelMatrix(ms * mt);
 		}
 		device.drawArrays(GL_TRIANGLE_STRIP, 0, 4);
@@ -403,16 +411,25 @@ void Font::drawText(const char* str, const Vector2& pos, Texture& tex, uint cons
 #endif
 }
 
+void Font::prewarm(const char* str, Font::Type type)
+{
+	Converter const& codes = conv_(str);
+	for (uint i = 0; i < codes.length(); i++) {
+		fontImageCreater[type].fontInfo(codes[i]);
+	}
+}
+
 kuto::Vector2 Font::textSize(const char* str, float size, Font::Type type)
 {
 	float width = 0.f;
 	float height = 0.f;
 	float const scale = size / FONT_BASE_SIZE;
-	std::string const strUtf32 = conv_(str);
-	for (uint i = 0; i < strUtf32.length() / sizeof(uint32_t); i++) {
-		uint32_t const code = *reinterpret_cast<uint32_t const*>( &strUtf32[i * sizeof(uint32_t)] );
+	Converter const& codes = conv_(str);
+	for (uint i = 0; i < codes.length(); i++) {
+		uint32_t const code = codes[i];
 
-		Vector2 const v = fontImageCreater[type].textCodeSize(code, scale);
+		FontInfo const& info = fontImageCreater[type].fontInfo(code);	// cached metrics, no FreeType call
+		Vector2 const v = Vector2(info.width, info.height) * scale;
 		width += ( (v.x / size) > 0.5f )? size : (size * 0.5f); // align // v.x;
 		if(v.x > height) height = v.y;
 	}
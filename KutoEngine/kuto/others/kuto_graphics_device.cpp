@@ -8,9 +8,13 @@
 #include <kuto/kuto_graphics_device.h>
 #include <kuto/kuto_touch_pad.h>
 #include <kuto/kuto_key_pad.h>
+#include <kuto/kuto_software_render_backend.h>
 
 #include <rpg2k/Define.hpp>
 
+#include <cstdio>
+#include <string>
+
 #if RPG2K_IS_PSP
 	#include <pspthreadman.h>
 #endif
@@ -207,6 +211,51 @@ bool GraphicsDevice::initialize(int& argc, char *argv[], int w, int h, const cha
 	return true;
 }
 
+/**
+ * ウィンドウを作らずにソフトウェアで描画する
+ * @param w				幅
+ * @param h				高さ
+ * @param func			毎フレームの更新関数
+ */
+bool GraphicsDevice::initializeHeadless(int w, int h, UpdateFunc func)
+{
+	width_ = w;
+	height_ = h;
+	updateFunc_ = func;
+	softwareBackend_.reset(new SoftwareRenderBackend(w, h));
+	setBackend(softwareBackend_.get());
+	return true;
+}
+
+/**
+ * ヘッドレス実行
+ * 入力なしでフレームを回す
+ * @param frameNum			フレーム数
+ * @param dumpDirectory		フレームごとにPNGを出力するディレクトリ（NULLなら出力しない）
+ * @retval false			PNGの出力に失敗した
+ */
+bool GraphicsDevice::runHeadless(int frameNum, const char* dumpDirectory)
+{
+	kuto_assert(softwareBackend_);
+	TouchInfo touch;
+	KeyInfo key;
+	for (int frame = 0; frame < frameNum; frame++) {
+		TouchPad::instance().setTouches(&touch, 1);
+		KeyPad::instance().setKeys(&key, 1);
+		updateFunc_(1.f);
+		if (dumpDirectory) {
+			char name[32];
+			std::sprintf(name, "/frame%05d.png", frame);
+			std::string const path = std::string(dumpDirectory) + name;
+			if (!softwareBackend_->writePNG(path.c_str())) {
+				std::fprintf(stderr, "failed to write %s\n", path.c_str());
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
 void GraphicsDevice::callbackGultDisplay()
 {
 	updateFunc_(1.f);
@@ -214,11 +263,13 @@ void GraphicsDevice::callbackGultDisplay()
 
 void GraphicsDevice::beginRender()
 {
-	glClear(GL_COLOR_BUFFER_BIT);
+	backend_->clear(Color(0.f, 0.f, 0.f, 1.f));
 
 	matrixMode_ = GL_MODELVIEW;
-	glMatrixMode(GL_MODELVIEW);
-	glLoadIdentity();
+	backend_->setMatrixMode(GL_MODELVIEW);
+	Matrix identity;
+	identity.identity();
+	backend_->loadMatrix(identity);
 
 	enableVertex_ = true; setGLClientState(GL_VERTEX_ARRAY, enableVertex_);
 	enableNormal_ = false; setGLClientState(GL_NORMAL_ARRAY, enableNormal_);
@@ -227,11 +278,11 @@ void GraphicsDevice::beginRender()
 	enableBlend_ = false; setGLEnable(GL_BLEND, enableBlend_);
 	blendSrcFactor_ = GL_SRC_ALPHA;
 	blendDestFactor_ = GL_ONE_MINUS_SRC_ALPHA;
-	::glBlendFunc(blendSrcFactor_, blendDestFactor_);
+	backend_->setBlendFunc(blendSrcFactor_, blendDestFactor_);
 	enableTexture2D_ = false;
 	bindTexture2D_ = 0;
 	setGLEnable(GL_TEXTURE_2D, enableTexture2D_);
-	::glBindTexture(GL_TEXTURE_2D, bindTexture2D_);
+	backend_->bindTexture(bindTexture2D_);
 	vertexPointerInfo_.set(0, 0, 0, 0);
 	texcoordPointerInfo_.set(0, 0, 0, 0);
 	colorPointerInfo_.set(0, 0, 0, 0);
@@ -239,7 +290,8 @@ void GraphicsDevice::beginRender()
 
 void GraphicsDevice::endRender()
 {
-	::glutSwapBuffers();
+	if (directGL())
+		::glutSwapBuffers();
 }
 
 void GraphicsDevice::setTitle(std::string const& title)
@@ -8,7 +8,7 @@ PATH = $(MINGWPATH)/bin
 LDFLAGS += -L$(MINGWPATH)/lib
 endif
 
-LIBS = -lpng -lz -lglut -lGLU -lGL \
+LIBS = -lpng -lz -lglut -lGLU -lGL -lpthread \
 	$(shell freetype-config --libs) \
 	$(shell freealut-config --libs) \
 	$(shell pkg-config openal --libs) \
@@ -130,6 +130,14 @@
 #define RPG2K_USE_DLMALLOC 0
 #define RPG2K_USE_NEDMALLOC 1
 
+/*
+ * map LCF files to memory with mmap() when reading
+ * ( otherwise the whole file is read to a buffer )
+ */
+#if !defined(RPG2K_USE_MMAP)
+	#define RPG2K_USE_MMAP (RPG2K_IS_UNIX || RPG2K_IS_LINUX || RPG2K_IS_MAC_OS_X || RPG2K_IS_IPHONE)
+#endif
+
 #include <cassert>
 #define rpg2k_assert(exp) assert(exp)
 
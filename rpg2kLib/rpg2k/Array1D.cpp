@@ -26,34 +26,104 @@ namespace rpg2k
 			std::map<unsigned, Binary>::iterator it = binBuf_.find(pos);
 			if( it == binBuf_.end() ) return false;
 
-			if( isArray2D() ) insert( pos, std::auto_ptr<Element>( new Element(owner(), index(), pos, it->second) ) );
-			else insert( pos, std::auto_ptr<Element>( new Element(*this, pos, it->second) ) );
+			if( isArray2D() ) insertElement( pos, std::auto_ptr<Element>( new Element(owner(), index(), pos, it->second) ) );
+			else insertElement( pos, std::auto_ptr<Element>( new Element(*this, pos, it->second) ) );
 			binBuf_.erase(it);
 
 			return true;
 		}
 
+		Element& Array1D::insertElement(unsigned index, std::auto_ptr<Element> e)
+		{
+			Element& ret = *insert(index, e).first->second;
+			if(index < DENSE_INDEX_MAX) {
+				if( table_.size() <= index ) table_.resize(index + 1, NULL);
+				table_[index] = &ret;
+			}
+			return ret;
+		}
+		Element* Array1D::lookup(unsigned const index) const
+		{
+			if(index < DENSE_INDEX_MAX) return (index < table_.size())? table_[index] : NULL;
+
+			const_iterator it = find(index);
+			return ( it != end() )? const_cast<Element*>(it->second) : NULL;
+		}
+		void Array1D::rebuildTable()
+		{
+			table_.clear();
+			for(iterator it = begin(); it != end(); ++it) {
+				if(it->first >= DENSE_INDEX_MAX) break;
+
+				if( table_.size() <= it->first ) table_.resize(it->first + 1, NULL);
+				table_[it->first] = it->second;
+			}
+		}
+		void Array1D::resetTable(unsigned const index)
+		{
+			if( index < table_.size() ) table_[index] = NULL;
+		#if RPG2K_DEBUG
+			// indexing an erased element again must not reach the erased one
+			rpg2k_assert( lookup(index) == NULL );
+		#endif
+		}
+		void Array1D::clear()
+		{
+			table_.clear();
+			binBuf_.clear();
+			BaseOfArray1D::clear();
+		}
+		Array1D::iterator Array1D::erase(iterator const it)
+		{
+			unsigned const index = it->first;
+			iterator const ret = BaseOfArray1D::erase(it);
+			resetTable(index);
+			return ret;
+		}
+		Array1D::iterator Array1D::erase(iterator const first, iterator const last)
+		{
+			iterator const ret = BaseOfArray1D::erase(first, last);
+			rebuildTable();
+			return ret;
+		}
+		Array1D::size_type Array1D::erase(unsigned const index)
+		{
+			size_type const ret = binBuf_.erase(index) + BaseOfArray1D::erase(index);
+			resetTable(index);
+			return ret;
+		}
+
 		Array1D::Array1D(Array1D const& src)
-		: BaseOfArray1D(src)
+		: BaseOfArray1D()
 		, binBuf_(src.binBuf_)
 		, arrayDefine_(src.arrayDefine_), this_(src.this_)
 		, exists_(src.exists_), owner_(src.owner_), index_(src.index_)
 		{
-			this->clear();
+			copyElements(src);
+		}
+		Array1D::Array1D(Element& e, Array1D const& src)
+		: BaseOfArray1D()
+		, binBuf_(src.binBuf_)
+		, arrayDefine_(src.arrayDefine_), this_(&e)
+		, exists_(src.exists_), owner_(NULL), index_(-1)
+		{
+			copyElements(src);
+		}
+		Array1D::Array1D(Array2D& owner, Array1D const& src)
+		: BaseOfArray1D()
+		, binBuf_(src.binBuf_)
+		, arrayDefine_(src.arrayDefine_), this_(NULL)
+		, exists_(src.exists_), owner_(&owner), index_(src.index_)
+		{
+			copyElements(src);
+		}
+		void Array1D::copyElements(Array1D const& src)
+		{
+			// copied directly, serializing and parsing again is slower
 			for(const_iterator it = src.begin(); it != src.end(); ++it) {
 				if( !it->second->exists() ) continue;
 
-				Binary bin = it->second->serialize();
-
-				if( bin.size() >= BIG_DATA_SIZE ) {
-					binBuf_.insert( std::make_pair( it->first, bin ) );
-				} else if( src.isArray2D() ) {
-					insert( it->first, std::auto_ptr<Element>( new Element(
-						src.owner(), src.index(), it->first, bin) ) );
-				} else {
-					insert( it->first, std::auto_ptr<Element>(
-						new Element(*this, it->first, bin) ) );
-				}
+				insertElement( it->first, std::auto_ptr<Element>( new Element(*this, *it->second) ) );
 			}
 		}
 
@@ -114,7 +184,7 @@ namespace rpg2k
 
 				s.get(bin);
 				if( bin.size() >= BIG_DATA_SIZE ) binBuf_.insert( std::make_pair(index2, bin) );
-				else insert( index2, std::auto_ptr<Element>( new Element(owner, index, index2, bin) ) );
+				else insertElement( index2, std::auto_ptr<Element>( new Element(owner, index, index2, bin) ) );
 			}
 		}
 		void Array1D::init(StreamReader& s)
@@ -130,7 +200,7 @@ namespace rpg2k
 
 				s.get(bin);
 				if( bin.size() >= BIG_DATA_SIZE ) binBuf_.insert( std::make_pair(index, bin) );
-				else insert( index, std::auto_ptr<Element>( new Element(*this, index, bin) ) );
+				else insertElement( index, std::auto_ptr<Element>( new Element(*this, index, bin) ) );
 
 				if( !toElement().hasOwner() && s.eof() ) return;
 			}
@@ -154,6 +224,7 @@ namespace rpg2k
 		Array1D const& Array1D::operator =(Array1D const& src)
 		{
 			BaseOfArray1D::operator =(src);
+			rebuildTable();
 			exists_ = src.exists_;
 
 			return *this;
@@ -161,18 +232,18 @@ namespace rpg2k
 
 		Element& Array1D::operator [](unsigned const index)
 		{
-			iterator it = find(index);
-			if( it != end() ) {
-				return *it->second;
+			Element* const e = lookup(index);
+			if(e != NULL) {
+				return *e;
 			} else if( createAt(index) ) {
-				return *this->find(index)->second;
+				return *lookup(index);
 			} else {
 				if( isArray2D() ) {
-					return *insert( index, std::auto_ptr<Element>(
-						new Element(*owner_, index_, index) ) ).first->second;
+					return insertElement( index, std::auto_ptr<Element>(
+						new Element(*owner_, index_, index) ) );
 				} else {
-					return *insert( index, std::auto_ptr<Element>(
-						new Element(*this, index) ) ).first->second;
+					return insertElement( index, std::auto_ptr<Element>(
+						new Element(*this, index) ) );
 				}
 			}
 		}
@@ -208,7 +279,7 @@ namespace rpg2k
 				ret += size;
 			}
 
-			if( toElement().hasOwner() ) ret += berSize(ARRAY_1D_END);
+			if( isArray2D() || toElement().hasOwner() ) ret += berSize(ARRAY_1D_END);
 
 			return ret;
 		}
@@ -218,7 +289,7 @@ namespace rpg2k
 				if( !it->second->exists() ) continue;
 
 				s.setBER( it->first );
-				s.setBER( it->second->serializedSize() );
+				s.setBER( it->second->lastSerializedSize() );
 				it->second->serialize(s);
 			}
 			for(std::map<unsigned, Binary>::const_iterator it = binBuf_.begin(); it != binBuf_.end(); ++it) {
@@ -227,7 +298,7 @@ namespace rpg2k
 				s.write(it->second);
 			}
 
-			if( toElement().hasOwner() ) s.setBER(ARRAY_1D_END);
+			if( isArray2D() || toElement().hasOwner() ) s.setBER(ARRAY_1D_END);
 		}
 
 		unsigned const& Array1D::index() const { rpg2k_assert( isArray2D() ); return index_; }
@@ -244,8 +315,8 @@ namespace rpg2k
 		}
 		bool Array1D::exists(unsigned index) const
 		{
-			const_iterator it = find(index);
-			return ( ( it != end() ) && it->second->exists() ) ||
+			Element const* const e = lookup(index);
+			return ( (e != NULL) && e->exists() ) ||
 				( binBuf_.find(index) != binBuf_.end() );
 		}
 	} // namespace structure
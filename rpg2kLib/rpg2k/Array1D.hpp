@@ -2,11 +2,8 @@
 #define _INC__RPG2K__MODEL__ARRAY_1D_HPP
 
 #include <map>
-#if RPG2K_DEBUG
-	#include <boost/ptr_container/ptr_map.hpp>
-#else
-	#include <boost/ptr_container/ptr_unordered_map.hpp>
-#endif
+#include <vector>
+#include <boost/ptr_container/ptr_map.hpp>
 #include "Descriptor.hpp"
 
 
@@ -22,31 +19,39 @@ namespace rpg2k
 		class StreamReader;
 		class StreamWriter;
 
-		#if RPG2K_DEBUG
-			typedef boost::ptr_map<unsigned, Element> BaseOfArray1D;
-		#else
-			typedef boost::ptr_unordered_map<unsigned, Element> BaseOfArray1D;
-		#endif
+		typedef boost::ptr_map<unsigned, Element> BaseOfArray1D;
 
 		class Array1D : public BaseOfArray1D
 		{
 		private:
 			std::map< unsigned, Binary > binBuf_;
 			ArrayDefine arrayDefine_;
+			/*
+			 * direct index of extracted elements.
+			 * indexes less than DENSE_INDEX_MAX are looked up without searching BaseOfArray1D.
+			 */
+			std::vector<Element*> table_;
 
 			Element* const this_;
 
 			bool exists_;
 			Array2D* const owner_;
 			unsigned const index_;
-
-			enum { ARRAY_1D_END = 0, };
 		protected:
 			Array1D();
 
 			void init(StreamReader& s);
 			bool createAt(unsigned pos);
+			void copyElements(Array1D const& src);
+
+			Element& insertElement(unsigned index, std::auto_ptr<Element> e);
+			Element* lookup(unsigned index) const;
+			void rebuildTable();
+			void resetTable(unsigned index);
 		public:
+			enum { ARRAY_1D_END = 0, };
+			enum { DENSE_INDEX_MAX = 256, };
+
 			typedef iterator Iterator;
 			typedef reverse_iterator RIterator;
 			typedef const_iterator ConstIterator;
@@ -65,6 +70,10 @@ namespace rpg2k
 			Array1D(Array2D& owner, unsigned index);
 			Array1D(Array2D& owner, unsigned index, StreamReader& f);
 
+			// copies of src owned by e or by owner
+			Array1D(Element& e, Array1D const& src);
+			Array1D(Array2D& owner, Array1D const& src);
+
 			Array1D const& operator =(Array1D const& src);
 
 			bool isArray2D() const { return owner_ != NULL; }
@@ -78,6 +87,12 @@ namespace rpg2k
 			bool exists() const;
 			bool exists(unsigned index) const;
 
+			void clear();
+			// these keep the direct index from pointing at erased elements
+			iterator erase(iterator it);
+			iterator erase(iterator first, iterator last);
+			size_type erase(unsigned index);
+
 			unsigned count() const;
 			unsigned serializedSize() const;
 			void serialize(StreamWriter& s) const;
@@ -37,25 +37,76 @@ namespace rpg2k
 		class EventState : public Array1D
 		{
 		public:
+			enum {
+				MAP_ID = 11, X = 12, Y = 13,
+				EVENT_DIR = 21, TALK_DIR = 22,
+				CHAR_SET = 73, CHAR_SET_POS = 74, CHAR_SET_DIR = 75,
+			};
+
 			EventState(Element& e) : Array1D(e) {}
 			EventState(Element& e, StreamReader& s) : Array1D(e, s) {}
 			EventState(Element& e, Binary const& b) : Array1D(e, b) {}
 
-			int mapID() const { return (*this)[11]; }
-			int x() const { return (*this)[12]; }
-			int y() const { return (*this)[13]; }
+			int mapID() const { return (*this)[MAP_ID]; }
+			int x() const { return (*this)[X]; }
+			int y() const { return (*this)[Y]; }
 			Vector2D position() const { return Vector2D( x(), y() ); }
+			void setPosition(int x, int y) { (*this)[X] = x; (*this)[Y] = y; }
 
-			RPG2kString const& charSet() const { return (*this)[73]; }
-			int charSetPos() const { return (*this)[74]; }
-			CharSet::Dir::Type charSetDir() const { return CharSet::Dir::Type( (*this)[75].to<int>() ); }
+			RPG2kString const& charSet() const { return (*this)[CHAR_SET]; }
+			int charSetPos() const { return (*this)[CHAR_SET_POS]; }
+			CharSet::Dir::Type charSetDir() const { return CharSet::Dir::Type( (*this)[CHAR_SET_DIR].to<int>() ); }
 			CharSet::Pat::Type charSetPat() const { return CharSet::Pat::MIDDLE; }
 
-			CharSet::Dir::Type eventDir() const { return CharSet::Dir::Type( (*this)[21].to<int>() ); }
-			CharSet::Dir::Type  talkDir() const { return CharSet::Dir::Type( (*this)[22].to<int>() ); }
+			CharSet::Dir::Type eventDir() const { return CharSet::Dir::Type( (*this)[EVENT_DIR].to<int>() ); }
+			CharSet::Dir::Type  talkDir() const { return CharSet::Dir::Type( (*this)[TALK_DIR].to<int>() ); }
+			void setDir(int dir) { (*this)[EVENT_DIR] = dir; (*this)[TALK_DIR] = dir; }
 
 			// CharSetDir charSetDir() const;
 		}; // class EventState
+
+		// typed view of map event page ( LcfMapUnit [81][evID][5][pageID] )
+		class EventPage
+		{
+		private:
+			Array1D const& page_;
+		public:
+			enum {
+				CHAR_SET = 21, CHAR_SET_POS = 22,
+				START_TYPE = 33, PRIORITY = 34, NO_PILE = 35,
+				EVENT = 52,
+			};
+
+			EventPage(Array1D const& page) : page_(page) {}
+
+			RPG2kString const& charSet() const { return page_[CHAR_SET]; }
+			int charSetPos() const { return page_[CHAR_SET_POS]; }
+
+			EventStart::Type startType() const { return EventStart::Type( page_[START_TYPE].to<int>() ); }
+			EventPriority::Type priority() const { return EventPriority::Type( page_[PRIORITY].to<int>() ); }
+			bool noPile() const { return page_[NO_PILE].to<bool>(); }
+
+			operator Array1D const&() const { return page_; }
+		}; // class EventPage
+
+		// typed view of chip set ( LcfDataBase [20][chipSetID] )
+		class ChipSet
+		{
+		private:
+			Array1D const& chipSet_;
+		public:
+			enum { NAME = 1, CHIP_SET = 2, TERRAIN = 3, LOWER = 4, UPPER = 5, };
+
+			ChipSet(Array1D const& chipSet) : chipSet_(chipSet) {}
+
+			RPG2kString const& chipSet() const { return chipSet_[CHIP_SET]; }
+			uint8_t flag(unsigned chipID, bool upper) const
+			{
+				return chipSet_[upper? UPPER : LOWER].toBinary()[chipID];
+			}
+
+			operator Array1D const&() const { return chipSet_; }
+		}; // class ChipSet
 	} // namespace structure
 } // namespace rpg2k
 
@@ -10,12 +10,19 @@ namespace rpg2k
 	namespace structure
 	{
 		Array2D::Array2D(Array2D const& src)
-		: arrayDefine_(src.arrayDefine_)
+		: rowBuf_(src.rowBuf_), arrayDefine_(src.arrayDefine_)
 		, this_(src.this_)
 		{
-			for(const_iterator it = src.begin(); it != src.end(); ++it) {
-				StreamReader stream( structure::serialize( *it->second ) );
-				insert( it->first, std::auto_ptr<Array1D>( new Array1D(*this, it->first, stream) ) );
+			for(const_iterator it = src.BaseOfArray2D::begin(); it != src.end(); ++it) {
+				insertRow( it->first, std::auto_ptr<Array1D>( new Array1D(*this, *it->second) ) );
+			}
+		}
+		Array2D::Array2D(Element& e, Array2D const& src)
+		: rowBuf_(src.rowBuf_), arrayDefine_(src.arrayDefine_)
+		, this_(&e)
+		{
+			for(const_iterator it = src.BaseOfArray2D::begin(); it != src.end(); ++it) {
+				insertRow( it->first, std::auto_ptr<Array1D>( new Array1D(*this, *it->second) ) );
 			}
 		}
 
@@ -58,11 +65,86 @@ namespace rpg2k
 		{
 			for(unsigned i = 0, length = s.ber(); i < length; i++) {
 				unsigned index = s.ber();
-				insert( index, std::auto_ptr<Array1D>( new Array1D(*this, index, s) ) );
+			#if RPG2K_DEBUG // if debuging ALL rows will be extracted
+				insertRow( index, std::auto_ptr<Array1D>( new Array1D(*this, index, s) ) );
+			#else
+				// only find the end of row and keep the data
+				unsigned const start = s.tell();
+				for(unsigned index2 = s.ber(); index2 != Array1D::ARRAY_1D_END; index2 = s.ber()) {
+					s.seekFromCur( s.ber() );
+				}
+				Binary& row = rowBuf_.insert( std::make_pair( index, Binary() ) )->second;
+				row.resize( s.tell() - start );
+				s.seekFromSet(start);
+				s.read(row);
+			#endif
 			}
 
 			if( toElement().hasOwner() ) rpg2k_analyze_assert( s.eof() );
 		}
+		void Array2D::createRow(unsigned const index) const
+		{
+			typedef std::multimap<unsigned, Binary>::iterator RowIterator;
+			std::pair<RowIterator, RowIterator> const range = rowBuf_.equal_range(index);
+			if( range.first == range.second ) return;
+
+			// rows of the same index are extracted in the order of the file
+			Array2D& self = const_cast<Array2D&>(*this);
+			for(RowIterator it = range.first; it != range.second; ++it) {
+				StreamReader s( std::auto_ptr<StreamInterface>( new BinaryReaderNoCopy(it->second) ) );
+				insertRow( index, std::auto_ptr<Array1D>( new Array1D(self, index, s) ) );
+			}
+			rowBuf_.erase(range.first, range.second);
+		}
+		Array1D& Array2D::insertRow(unsigned index, std::auto_ptr<Array1D> row) const
+		{
+			Array1D& ret = *const_cast<Array2D&>(*this).insert(index, row)->second;
+			// the first row of the index is the one find() returns
+			if(index < DENSE_INDEX_MAX) {
+				if( table_.size() <= index ) table_.resize(index + 1, NULL);
+				if( !table_[index] ) table_[index] = &ret;
+			}
+			return ret;
+		}
+		Array1D* Array2D::lookup(unsigned const index) const
+		{
+			if(index < DENSE_INDEX_MAX) {
+				if( ( index < table_.size() ) && table_[index] ) return table_[index];
+				else if( rowBuf_.empty() ) return NULL;
+			}
+
+			createRow(index);
+			if(index < DENSE_INDEX_MAX) return ( index < table_.size() )? table_[index] : NULL;
+
+			const_iterator it = BaseOfArray2D::find(index);
+			return ( it != end() )? const_cast<Array1D*>(it->second) : NULL;
+		}
+		void Array2D::rebuildTable()
+		{
+			table_.clear();
+			for(iterator it = BaseOfArray2D::begin(); it != end(); ++it) {
+				if(it->first >= DENSE_INDEX_MAX) break;
+
+				if( table_.size() <= it->first ) table_.resize(it->first + 1, NULL);
+				if( !table_[it->first] ) table_[it->first] = it->second;
+			}
+		}
+		void Array2D::resetTable(unsigned const index)
+		{
+			if( index < table_.size() ) {
+				iterator const it = BaseOfArray2D::find(index);
+				table_[index] = ( it != end() )? it->second : NULL;
+			}
+		#if RPG2K_DEBUG
+			// indexing an erased row again must reach the remaining row or nothing
+			const_iterator const found = BaseOfArray2D::find(index);
+			rpg2k_assert( lookup(index) == ( ( found != end() )? found->second : NULL ) );
+		#endif
+		}
+		void Array2D::createAllRows() const
+		{
+			while( !rowBuf_.empty() ) createRow( rowBuf_.begin()->first );
+		}
 
 	/*
 	 *  Checking if the input Binary is particular Array2D.
@@ -93,29 +175,48 @@ namespace rpg2k
 		Array2D const& Array2D::operator =(Array2D const& src)
 		{
 			BaseOfArray2D::operator =(src);
+			rowBuf_ = src.rowBuf_;
+			rebuildTable();
 			return *this;
 		}
 
+		Array2D::iterator Array2D::erase(iterator const it)
+		{
+			unsigned const index = it->first;
+			iterator const ret = BaseOfArray2D::erase(it);
+			resetTable(index);
+			return ret;
+		}
+		Array2D::iterator Array2D::erase(iterator const first, iterator const last)
+		{
+			iterator const ret = BaseOfArray2D::erase(first, last);
+			rebuildTable();
+			return ret;
+		}
+		Array2D::size_type Array2D::erase(unsigned const index)
+		{
+			size_type const ret = rowBuf_.erase(index) + BaseOfArray2D::erase(index);
+			resetTable(index);
+			return ret;
+		}
+
 		Array1D& Array2D::operator [](unsigned const index)
 		{
-			iterator it = this->find(index);
-			if( it != this->end() ) return *it->second;
-			else {
-				return *insert( index, std::auto_ptr<Array1D>(
-					new Array1D(*this, index) ) )->second;
-			}
+			Array1D* const row = lookup(index);
+			if(row != NULL) return *row;
+			else return insertRow( index, std::auto_ptr<Array1D>( new Array1D(*this, index) ) );
 		}
 		Array1D const& Array2D::operator [](unsigned const index) const
 		{
-			const_iterator it = this->find(index);
-			rpg2k_assert( it != this->end() );
-			return *it->second;
+			Array1D const* const row = lookup(index);
+			rpg2k_assert(row != NULL);
+			return *row;
 		}
 
 		unsigned Array2D::count() const
 		{
-			unsigned ret = 0;
-			for(const_iterator it = begin(); it != end(); ++it) {
+			unsigned ret = rowBuf_.size();
+			for(const_iterator it = BaseOfArray2D::begin(); it != end(); ++it) {
 				if( it->second->exists() ) ret++;
 			}
 			return ret;
@@ -125,37 +226,53 @@ namespace rpg2k
 			unsigned ret = 0;
 
 			ret += berSize( count() );
-			for(const_iterator it = begin(); it != end(); ++it) {
+			for(const_iterator it = BaseOfArray2D::begin(); it != end(); ++it) {
 				if( !it->second->exists() ) continue;
 
 				ret += berSize( it->first );
 				ret += it->second->serializedSize();
 			}
+			for(std::multimap<unsigned, Binary>::const_iterator it = rowBuf_.begin(); it != rowBuf_.end(); ++it) {
+				ret += berSize(it->first);
+				ret += it->second.size();
+			}
 
 			return ret;
 		}
 		void Array2D::serialize(StreamWriter& s) const
 		{
 			s.setBER( count() );
-			for(const_iterator it = begin(); it != end(); ++it) {
-				if( !it->second->exists() ) continue;
-
-				s.setBER( it->first );
-				it->second->serialize(s);
+			// write extracted and unextracted rows in index order
+			const_iterator it = BaseOfArray2D::begin();
+			std::multimap<unsigned, Binary>::const_iterator rowIt = rowBuf_.begin();
+			while( ( it != end() ) || ( rowIt != rowBuf_.end() ) ) {
+				if( ( rowIt == rowBuf_.end() ) || ( ( it != end() ) && (it->first < rowIt->first) ) ) {
+					if( it->second->exists() ) {
+						s.setBER( it->first );
+						it->second->serialize(s);
+					}
+					++it;
+				} else {
+					s.setBER(rowIt->first);
+					s.write(rowIt->second);
+					++rowIt;
+				}
 			}
 		}
 
 		bool Array2D::exists(unsigned const index) const
 		{
-			const_iterator it = find(index);
-			return( ( it != end() ) && it->second->exists() );
+			if( rowBuf_.find(index) != rowBuf_.end() ) return true;
+
+			Array1D const* const row = lookup(index);
+			return( (row != NULL) && row->exists() );
 		}
 		bool Array2D::exists(unsigned index1, unsigned index2) const
 		{
-			Array2D::const_iterator it1 = find(index1);
-			if( ( it1 != end() ) && it1->second->exists() ) {
-				Array1D::const_iterator it2 = it1->second->find(index2);
-				return( ( it2 != it1->second->end() ) && it2->second->exists() );
+			Array1D const* const row = lookup(index1);
+			if( (row != NULL) && row->exists() ) {
+				Array1D::const_iterator it2 = row->find(index2);
+				return( ( it2 != row->end() ) && it2->second->exists() );
 			}
 			return false;
 		}
@@ -1,6 +1,8 @@
 #ifndef _INC__RPG2K__MODEL__ARRAY_2D_HPP
 #define _INC__RPG2K__MODEL__ARRAY_2D_HPP
 
+#include <map>
+#include <vector>
 #include <boost/ptr_container/ptr_map.hpp>
 #include "Descriptor.hpp"
 
@@ -21,14 +23,36 @@ namespace rpg2k
 		class Array2D : public BaseOfArray2D
 		{
 		private:
+			/*
+			 * rows that aren't extracted yet.
+			 * a row is extracted at the first access from find() or operator [].
+			 * BaseOfArray2D is a multimap so the same index may appear more than once.
+			 * those rows are kept and extracted together.
+			 */
+			mutable std::multimap<unsigned, Binary> rowBuf_;
 			ArrayDefine arrayDefine_;
+			/*
+			 * direct index of extracted rows.
+			 * indexes less than DENSE_INDEX_MAX are looked up without searching BaseOfArray2D.
+			 */
+			mutable std::vector<Array1D*> table_;
 
 			Element* const this_;
+
+			void createRow(unsigned index) const;
+			void createAllRows() const;
+
+			Array1D& insertRow(unsigned index, std::auto_ptr<Array1D> row) const;
+			Array1D* lookup(unsigned index) const;
+			void rebuildTable();
+			void resetTable(unsigned index);
 		protected:
 			Array2D();
 			void init(StreamReader& f);
 			bool isInvalidArray2D(Binary const& b);
 		public:
+			enum { DENSE_INDEX_MAX = 10000, };
+
 			typedef iterator Iterator;
 			typedef reverse_iterator RIterator;
 			typedef const_iterator ConstIterator;
@@ -43,9 +67,30 @@ namespace rpg2k
 			Array2D(Element& e);
 			Array2D(Element& e, StreamReader& s);
 			Array2D(Element& e, Binary const& b);
+			// copy of src owned by e
+			Array2D(Element& e, Array2D const& src);
 
 			Array2D const& operator =(Array2D const& src);
 
+			/*
+			 * these extract rows before accessing BaseOfArray2D.
+			 * begin() and rbegin() extract ALL the rows, so iterating isn't lazy.
+			 * use operator [] or exists() when only some rows are needed.
+			 */
+			iterator find(unsigned index) { createRow(index); return BaseOfArray2D::find(index); }
+			const_iterator find(unsigned index) const { createRow(index); return BaseOfArray2D::find(index); }
+			iterator begin() { createAllRows(); return BaseOfArray2D::begin(); }
+			const_iterator begin() const { createAllRows(); return BaseOfArray2D::begin(); }
+			reverse_iterator rbegin() { createAllRows(); return BaseOfArray2D::rbegin(); }
+			const_reverse_iterator rbegin() const { createAllRows(); return BaseOfArray2D::rbegin(); }
+			size_type size() const { return BaseOfArray2D::size() + rowBuf_.size(); }
+			bool empty() const { return BaseOfArray2D::empty() && rowBuf_.empty(); }
+			void clear() { rowBuf_.clear(); table_.clear(); BaseOfArray2D::clear(); }
+			// these keep the direct index from pointing at erased rows
+			iterator erase(iterator it);
+			iterator erase(iterator first, iterator last);
+			size_type erase(unsigned index);
+
 			Array1D& operator [](unsigned index);
 			Array1D const& operator [](unsigned index) const;
 
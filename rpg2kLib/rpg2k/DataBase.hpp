@@ -62,6 +62,7 @@ namespace rpg2k
 			structure::Array2D const& commonEvent() const { return (*this)[25]; }
 
 			RPG2kString const& vocabulary(unsigned index) const;
+			unsigned vocabularySize() const { return vocabulary_.size(); }
 
 			std::vector<uint16_t> const& terrain(unsigned id) const;
 			std::vector<uint8_t> const& chipFlag(unsigned id, ChipSet::Type t) const;
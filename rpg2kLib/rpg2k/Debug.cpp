@@ -236,7 +236,7 @@ namespace rpg2k
 				<< "integer[" << inst.argNum() << "]: "
 				;
 				ostrm << "{ ";
-					std::copy( inst.args().begin(), inst.args().end()
+					std::copy( inst.args(), inst.args() + inst.argNum()
 					, std::ostream_iterator<int32_t>(ostrm, ", ") );
 				ostrm << "}, ";
 			ostrm << "}";
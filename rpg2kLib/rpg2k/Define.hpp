@@ -67,6 +67,7 @@ namespace rpg2k
 		DATA_BASE_MAX = 5000,
 
 		MAP_UNIT_MAX = 9999, SAVE_DATA_MAX = 15,
+		MAP_UNIT_CACHE_SIZE = 2 * 1024 * 1024, // default budget of loaded map units in file bytes
 
 		CHIP_REPLACE_MAX = 144,
 
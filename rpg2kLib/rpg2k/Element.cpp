@@ -68,9 +68,8 @@ namespace rpg2k
 		}
 		void BerEnum::serialize(StreamWriter& s) const
 		{
-			Binary b = ( std::vector<unsigned>& ) *this;
-			s.setBER( b.size() - 1 );
-			s.write(b);
+			s.setBER( size() - 1 );
+			for(unsigned i = 0; i < size(); i++) s.setBER( (*this)[i] );
 		}
 /*
 		CharSetDir EventState::charSetDir() const
@@ -89,14 +88,15 @@ namespace rpg2k
 				PP_rpg2kTypes(PP_enum)
 				#undef PP_enum
 
-				#define PP_enum(TYPE) \
-					case ElementType::TYPE##_: { \
-						Binary bin; \
-						bin = *impl_.TYPE##_; \
-						s.write(bin); \
-					} break;
-				PP_basicTypes(PP_enum)
-				#undef PP_enum
+				// basic types are written without a temporary Binary
+				case ElementType::int_: s.setBER( impl_.int_ ); break;
+				case ElementType::bool_: s.write( uint8_t(impl_.bool_) ); break;
+				case ElementType::double_:
+					s.write( reinterpret_cast<uint8_t const*>(&impl_.double_), sizeof(double) );
+					break;
+				case ElementType::string_:
+					s.write( reinterpret_cast<uint8_t const*>( impl_.string_->data() ), impl_.string_->size() );
+					break;
 			} else s.write(binData_);
 		}
 		unsigned Element::serializedSize() const
@@ -104,21 +104,20 @@ namespace rpg2k
 			if( isDefined() ) switch( descriptor_->type() ) {
 				#define PP_enum(TYPE) \
 					case ElementType::TYPE##_: \
-						return impl_.TYPE##_->serializedSize();
+						serializedSize_ = impl_.TYPE##_->serializedSize(); \
+						break;
 				PP_rpg2kTypes(PP_enum)
 				#undef PP_enum
 
-				#define PP_enum(TYPE) \
-					case ElementType::TYPE##_: { \
-						Binary bin; \
-						bin = *impl_.TYPE##_; \
-						return bin.size(); \
-					}
-				PP_basicTypes(PP_enum)
-				#undef PP_enum
+				case ElementType::int_: serializedSize_ = berSize( impl_.int_ ); break;
+				case ElementType::bool_: serializedSize_ = sizeof(uint8_t); break;
+				case ElementType::double_: serializedSize_ = sizeof(double); break;
+				case ElementType::string_: serializedSize_ = impl_.string_->size(); break;
+
+				default: rpg2k_assert(false); serializedSize_ = 0; break;
+			} else serializedSize_ = binData_.size();
 
-				default: rpg2k_assert(false); return 0;
-			} else return binData_.size();
+			return serializedSize_;
 		}
 
 		Element::Element(Element const& e)
@@ -126,15 +125,14 @@ namespace rpg2k
 		, exists_(e.exists_), owner_(e.owner_)
 		, index1_(e.index1_), index2_(e.index2_)
 		{
-			if( isDefined() ) switch( descriptor_->type() ) {
-				#define PP_enum(TYPE) \
-					case ElementType::TYPE##_: \
-						impl_.TYPE##_ = new TYPE( *e.impl_.TYPE##_ ); \
-						break;
-				PP_basicTypes(PP_enum)
-				PP_rpg2kTypes(PP_enum)
-				#undef PP_enum
-			}
+			init(e);
+		}
+		Element::Element(Array1D const& owner, Element const& e)
+		: descriptor_(e.descriptor_)
+		, exists_(e.exists_), owner_( &owner.toElement() )
+		, index1_(e.index1_), index2_(e.index2_)
+		{
+			init(e);
 		}
 
 		void Element::init()
@@ -144,10 +142,13 @@ namespace rpg2k
 			if( descriptor_->hasDefault() ) switch( descriptor_->type() ) {
 				#define PP_enum(TYPE) \
 					case ElementType::TYPE##_: \
-						impl_.TYPE##_ = new TYPE(*descriptor_); \
+						impl_.TYPE##_ = static_cast<TYPE const&>(*descriptor_); \
 						break;
-				PP_basicTypes(PP_enum)
+				PP_inlineTypes(PP_enum)
 				#undef PP_enum
+				case ElementType::string_:
+					impl_.string_ = new string( static_cast<string const&>(*descriptor_) );
+					break;
 
 				#define PP_enum(TYPE) \
 					case ElementType::TYPE##_: \
@@ -167,7 +168,13 @@ namespace rpg2k
 
 				default: rpg2k_analyze_assert(false); break;
 			} else switch( descriptor_->type() ) {
-				PP_basicTypes(PP_enumNoDefault)
+				#define PP_enum(TYPE) \
+					case ElementType::TYPE##_: \
+						impl_.TYPE##_ = TYPE(); \
+						break;
+				PP_inlineTypes(PP_enum)
+				#undef PP_enum
+				PP_enumNoDefault(string)
 				PP_enumNoDefault(BerEnum)
 				PP_enumNoDefault(Binary)
 				PP_enumNoDefault(Event)
@@ -189,11 +196,18 @@ namespace rpg2k
 				PP_enum(Array2D)
 				#undef PP_enum
 
+				#define PP_enum(TYPE) \
+					case ElementType::TYPE##_: \
+						impl_.TYPE##_ = static_cast<TYPE>(b); \
+						break;
+				PP_inlineTypes(PP_enum)
+				#undef PP_enum
+
 				#define PP_enum(TYPE) \
 					case ElementType::TYPE##_: \
 						impl_.TYPE##_ = new TYPE(b); \
 						break;
-				PP_basicTypes(PP_enum)
+				PP_enum(string)
 				PP_enum(BerEnum)
 				PP_enum(Binary)
 				PP_enum(Event)
@@ -222,6 +236,35 @@ namespace rpg2k
 			}
 		}
 
+		void Element::init(Element const& e)
+		{
+			if( isDefined() ) switch( descriptor_->type() ) {
+				#define PP_enum(TYPE) \
+					case ElementType::TYPE##_: \
+						impl_.TYPE##_ = e.impl_.TYPE##_; \
+						break;
+				PP_inlineTypes(PP_enum)
+				#undef PP_enum
+				// arrays are copied with this as the owner of their elements
+				#define PP_enum(TYPE) \
+					case ElementType::TYPE##_: \
+						impl_.TYPE##_ = new TYPE(*this, *e.impl_.TYPE##_); \
+						break;
+				PP_enum(Array1D)
+				PP_enum(Array2D)
+				#undef PP_enum
+				#define PP_enum(TYPE) \
+					case ElementType::TYPE##_: \
+						impl_.TYPE##_ = new TYPE( *e.impl_.TYPE##_ ); \
+						break;
+				PP_enum(string)
+				PP_enum(Event)
+				PP_enum(BerEnum)
+				PP_enum(Binary)
+				#undef PP_enum
+			} else binData_ = e.binData_;
+		}
+
 		Element::Element()
 		: descriptor_(NULL), owner_(NULL), index1_(-1), index2_(-1)
 		{
@@ -298,21 +341,26 @@ namespace rpg2k
 
 			if( isDefined() ) switch( descriptor_->type() ) {
 				#define PP_enum(TYPE) case ElementType::TYPE##_: delete impl_.TYPE##_; break;
-				PP_basicTypes(PP_enum)
-				PP_rpg2kTypes(PP_enum)
+				PP_boxedTypes(PP_enum)
 				#undef PP_enum
+				default: break;
 			}
 		}
 
 		Element const& Element::operator =(Element const& src)
 		{
 			if( isDefined() ) switch( descriptor_->type() ) {
+				#define PP_enum(TYPE) \
+					case ElementType::TYPE##_: \
+						impl_.TYPE##_ = src.impl_.TYPE##_; \
+						break;
+				PP_inlineTypes(PP_enum)
+				#undef PP_enum
 				#define PP_enum(TYPE) \
 					case ElementType::TYPE##_: \
 						(*impl_.TYPE##_) = (*src.impl_.TYPE##_); \
 						break;
-				PP_basicTypes(PP_enum)
-				PP_rpg2kTypes(PP_enum)
+				PP_boxedTypes(PP_enum)
 				#undef PP_enum
 				default: rpg2k_assert(false); break;
 			} else binData_ = src.binData_;
@@ -352,7 +400,7 @@ namespace rpg2k
 			if( descriptor_ && descriptor_->hasDefault() ) switch( descriptor_->type() ) {
 				#define PP_enum(TYPE) \
 					case ElementType::TYPE##_: \
-						if( (*impl_.TYPE##_) == static_cast<TYPE const&>(*descriptor_) ) { \
+						if( to<TYPE>() == static_cast<TYPE const&>(*descriptor_) ) { \
 							exists_ = false; \
 							return; \
 						} \
@@ -384,6 +432,22 @@ namespace rpg2k
 			return *descriptor_;
 		}
 
+		#define PP_castOperator(TYPE) \
+			Element::operator TYPE const&() const \
+			{ \
+				rpg2k_assert( this->isDefined() ); \
+				rpg2k_assert( descriptor_->type() == ElementType::TYPE##_ ); \
+				return impl_.TYPE##_; \
+			} \
+			Element::operator TYPE&() \
+			{ \
+				rpg2k_assert( this->isDefined() ); \
+				rpg2k_assert( descriptor_->type() == ElementType::TYPE##_ ); \
+				return impl_.TYPE##_; \
+			}
+		PP_inlineTypes(PP_castOperator)
+		#undef PP_castOperator
+
 		#define PP_castOperator(TYPE) \
 			Element::operator TYPE const&() const \
 			{ \
@@ -399,8 +463,7 @@ namespace rpg2k
 				rpg2k_assert( impl_.TYPE##_ ); \
 				return *impl_.TYPE##_; \
 			}
-		PP_basicTypes(PP_castOperator)
-		PP_rpg2kTypes(PP_castOperator)
+		PP_boxedTypes(PP_castOperator)
 		#undef PP_castOperator
 	} // namespace structure
 } // namespace rpg2k
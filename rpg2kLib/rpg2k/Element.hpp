@@ -14,6 +14,15 @@ namespace rpg2k
 		class StreamReader;
 		class StreamWriter;
 
+		// scalars are stored inline, others are boxed
+		#define PP_inlineTypes(func) \
+			func(int) \
+			func(bool) \
+			func(double)
+		#define PP_boxedTypes(func) \
+			func(string) \
+			PP_rpg2kTypes(func)
+
 		class Element
 		{
 		private:
@@ -26,17 +35,22 @@ namespace rpg2k
 			unsigned const index2_;
 
 			union {
+				#define PP_types(TYPE) TYPE TYPE##_;
+				PP_inlineTypes(PP_types)
+				#undef PP_types
 				#define PP_types(TYPE) TYPE* TYPE##_;
-				PP_basicTypes(PP_types)
-				PP_rpg2kTypes(PP_types)
+				PP_boxedTypes(PP_types)
 				#undef PP_types
 			} impl_;
 
 			Binary binData_;
+			// result of the last serializedSize(), read by the owner's serialize()
+			mutable unsigned serializedSize_;
 
 			void init();
 			void init(Binary const& b);
 			void init(StreamReader& s);
+			void init(Element const& e);
 		public:
 			Element();
 			Element(Element const& e);
@@ -48,6 +62,8 @@ namespace rpg2k
 			Element(Array1D const& owner, unsigned index , Binary const& b);
 			Element(Array2D const& owner, unsigned index1, unsigned index2);
 			Element(Array2D const& owner, unsigned index1, unsigned index2, Binary const& b);
+			// copy of e owned by owner
+			Element(Array1D const& owner, Element const& e);
 
 			bool isDefined() const { return descriptor_ != NULL; }
 			bool hasOwner() const { return owner_ != NULL; }
@@ -57,9 +73,16 @@ namespace rpg2k
 
 			Descriptor const& descriptor() const;
 
+			/*
+			 * serializedSize() sizes the whole subtree in one pass and remembers
+			 * the size of every element in it.
+			 * serialize(s) writes with those sizes, so it must follow serializedSize()
+			 * without modification in between.
+			 */
 			unsigned serializedSize() const;
 			void serialize(StreamWriter& s) const;
 			Binary serialize() const;
+			unsigned lastSerializedSize() const { return serializedSize_; }
 
 			#define PP_castOperator(TYPE) \
 				operator TYPE const&() const; \
@@ -125,6 +148,7 @@ namespace rpg2k
 		{
 		protected:
 			void init(StreamReader& s);
+			void init(Element const& e);
 		public:
 			BerEnum() {}
 			BerEnum(StreamReader& s);
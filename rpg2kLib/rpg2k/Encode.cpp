@@ -1,9 +1,111 @@
+#include <algorithm>
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
 
 #include "Debug.hpp"
 #include "Encode.hpp"
+#include "define/Define.hpp"
 
 
+namespace
+{
+	using rpg2k::define::CP932;
+	using rpg2k::define::CP932_LEAD_NUM;
+	using rpg2k::define::CP932_TRAIL_BEGIN;
+	using rpg2k::define::CP932_TRAIL_NUM;
+
+	uint32_t const REPLACEMENT = 0xfffd;
+	uint8_t const CP932_REPLACEMENT = '?';
+
+	unsigned const CP932_KANA_BEGIN = 0xa1, CP932_KANA_END = 0xdf; // half width katakana
+	uint32_t const UNICODE_KANA_BEGIN = 0xff61;
+	unsigned const CP932_LEAD_ROW_LOW = 0x9f - 0x81 + 1; // rows of 0x81-0x9f
+
+	inline bool isLeadByte(unsigned const c)
+	{
+		return ( (0x81 <= c) && (c <= 0x9f) ) || ( (0xe0 <= c) && (c <= 0xfc) );
+	}
+	inline unsigned leadRow(unsigned const c)
+	{
+		return (c <= 0x9f) ? (c - 0x81) : (c - 0xe0 + CP932_LEAD_ROW_LOW);
+	}
+	inline unsigned rowLead(unsigned const row)
+	{
+		return (row < CP932_LEAD_ROW_LOW) ? (0x81 + row) : (0xe0 + row - CP932_LEAD_ROW_LOW);
+	}
+
+	// copies the leading ascii run, 4 bytes at a time while none of them has the high bit
+	inline void copyASCII(uint8_t const*& src, uint8_t const* const end, uint8_t*& dst)
+	{
+		uint32_t word;
+		while( (end - src) >= 4 ) {
+			std::memcpy(&word, src, sizeof(word));
+			if(word & 0x80808080u) break;
+			std::memcpy(dst, &word, sizeof(word));
+			src += 4; dst += 4;
+		}
+		while( (src < end) && !(*src & 0x80) ) *dst++ = *src++;
+	}
+
+	// decodes the non ascii character starting with c, src is after c
+	uint32_t decodeCP932(unsigned const c, uint8_t const*& src, uint8_t const* const end)
+	{
+		if( (CP932_KANA_BEGIN <= c) && (c <= CP932_KANA_END) ) return UNICODE_KANA_BEGIN + (c - CP932_KANA_BEGIN);
+		if( !isLeadByte(c) || (src == end) ) return REPLACEMENT;
+
+		unsigned const trail = *src;
+		if( (trail < CP932_TRAIL_BEGIN) || (CP932_TRAIL_BEGIN + CP932_TRAIL_NUM <= trail) ) return REPLACEMENT;
+		++src;
+
+		uint16_t const code = CP932[ leadRow(c) * CP932_TRAIL_NUM + (trail - CP932_TRAIL_BEGIN) ];
+		return code ? code : REPLACEMENT;
+	}
+	uint32_t decodeUTF8(unsigned const c, uint8_t const*& src, uint8_t const* const end)
+	{
+		std::size_t num;
+		uint32_t code, min;
+		if     ( (c & 0xe0) == 0xc0 ) { num = 1; code = c & 0x1f; min = 0x80; }
+		else if( (c & 0xf0) == 0xe0 ) { num = 2; code = c & 0x0f; min = 0x800; }
+		else if( (c & 0xf8) == 0xf0 ) { num = 3; code = c & 0x07; min = 0x10000; }
+		else return REPLACEMENT;
+
+		if( std::size_t(end - src) < num ) return REPLACEMENT;
+		for(std::size_t i = 0; i < num; i++) {
+			if( (src[i] & 0xc0) != 0x80 ) return REPLACEMENT;
+			code = (code << 6) | (src[i] & 0x3f);
+		}
+		// overlong, surrogate and out of range sequences
+		if( (code < min) || (0x10ffff < code) || ( (0xd800 <= code) && (code <= 0xdfff) ) ) return REPLACEMENT;
+
+		src += num;
+		return code;
+	}
+	// code is never ascii here
+	inline uint8_t* encodeUTF8(uint32_t const code, uint8_t* dst)
+	{
+		if(code < 0x800) {
+			*dst++ = 0xc0 | (code >> 6);
+		} else {
+			*dst++ = 0xe0 | (code >> 12);
+			*dst++ = 0x80 | ( (code >> 6) & 0x3f );
+		}
+		*dst++ = 0x80 | (code & 0x3f);
+		return dst;
+	}
+
+	// compares encoding names ignoring case, '-' and '_'
+	std::string encodingKey(std::string const& name)
+	{
+		std::string ret;
+		for(std::string::const_iterator it = name.begin(); it != name.end(); ++it) {
+			if( (*it == '-') || (*it == '_') ) continue;
+			ret += std::toupper(*it);
+		}
+		return ret;
+	}
+} // namespace
+
 namespace rpg2k
 {
 	#if RPG2K_IS_WINDOWS
@@ -11,7 +113,6 @@ namespace rpg2k
 	#else
 		std::string const Encode::SYSTEM_ENCODE = "UTF-8";
 	#endif
-	std::string const Encode::RPG2K_ENCODE = "Windows-31J"; // "Shift_JIS";
 
 	Encode::Encode()
 	{
@@ -32,15 +133,31 @@ namespace rpg2k
 		}
 		#undef getlang
 
-		toSystem_ = openConverter(sysEncode_, RPG2K_ENCODE);
-		toRPG2k_  = openConverter(RPG2K_ENCODE, sysEncode_);
+		// only UTF-8 and CP932 are supported as the system encoding
+		std::string const key = encodingKey(sysEncode_);
+		if( key == "UTF8" ) systemIsUTF8_ = true;
+		else if( (key == "WINDOWS31J") || (key == "CP932") || (key == "MS932")
+		|| (key == "SJIS") || (key == "SHIFTJIS") ) systemIsUTF8_ = false;
+		else {
+			sysEncode_ = SYSTEM_ENCODE;
+			systemIsUTF8_ = (encodingKey(SYSTEM_ENCODE) == "UTF8");
+		}
+
+		// reverse table of define::CP932
+		fromUnicode_.assign(0x100, 0);
+		std::fill(fromUnicodePage_, fromUnicodePage_ + 0x100, 0);
+		for(unsigned c = CP932_KANA_BEGIN; c <= CP932_KANA_END; c++) {
+			addCP932(UNICODE_KANA_BEGIN + (c - CP932_KANA_BEGIN), c);
+		}
+		for(unsigned row = 0; row < unsigned(CP932_LEAD_NUM); row++) {
+			for(unsigned trail = 0; trail < unsigned(CP932_TRAIL_NUM); trail++) {
+				uint16_t const code = CP932[row * CP932_TRAIL_NUM + trail];
+				if(code) addCP932( code, (rowLead(row) << 8) | (CP932_TRAIL_BEGIN + trail) );
+			}
+		}
 	}
 	Encode::~Encode()
 	{
-		rpg2k_assert( ::iconv_close(toSystem_) != -1 );
-		rpg2k_assert( ::iconv_close(toRPG2k_ ) != -1 );
-
-		toSystem_ = toRPG2k_ = NULL;
 	}
 
 	Encode& Encode::instance()
@@ -49,32 +166,94 @@ namespace rpg2k
 		return theEncode;
 	}
 
-	iconv_t Encode::openConverter(std::string const& to, std::string const& from)
+	void Encode::addCP932(uint16_t const code, uint16_t const cp932)
+	{
+		uint16_t& page = fromUnicodePage_[code >> 8];
+		if(!page) {
+			page = fromUnicode_.size() >> 8;
+			fromUnicode_.resize(fromUnicode_.size() + 0x100, 0);
+		}
+		uint16_t& dst = fromUnicode_[ (page << 8) | (code & 0xff) ];
+		// NEC and IBM extensions have duplicates. the table is walked in ascending order so the lowest code is kept
+		if(!dst) dst = cp932;
+	}
+	uint16_t Encode::toCP932(uint32_t const code) const
+	{
+		if(0xffff < code) return 0;
+		return fromUnicode_[ (fromUnicodePage_[code >> 8] << 8) | (code & 0xff) ];
+	}
+
+	SystemString Encode::toSystem(RPG2kString const& src) const
+	{
+		if( !systemIsUTF8_ || src.empty() ) return SystemString(src);
+
+		SystemString ret(src.size() * SYSTEM_EXPANSION, '\0');
+		ret.resize( toSystem( src.data(), src.size(), &ret[0] ) );
+		return ret;
+	}
+	RPG2kString Encode::toRPG2k(SystemString const& src) const
 	{
-		iconv_t ret = ::iconv_open( to.c_str(), from.c_str() );
-		rpg2k_assert( ret != (iconv_t)-1 );
+		if( !systemIsUTF8_ || src.empty() ) return RPG2kString(src);
+
+		RPG2kString ret(src.size(), '\0');
+		ret.resize( toRPG2k( src.data(), src.size(), &ret[0] ) );
 		return ret;
 	}
 
-	std::string Encode::convertString(std::string const& src, iconv_t cd)
+	std::size_t Encode::toSystem(char const* const src, std::size_t const len, char* const dst) const
 	{
-		char iconvBuff[BUFF_SIZE];
-		size_t iconvOutSize = BUFF_SIZE, iconvInSize  = src.length();
-		char* iconvOut = iconvBuff;
-		#if RPG2K_IS_PSP && !defined(_LIBICONV_H)
-			char const* iconvIn  = src.c_str();
-		#else
-			char* iconvIn  = const_cast< char* >( src.c_str() );
-		#endif
+		if(!systemIsUTF8_) {
+			std::memcpy(dst, src, len);
+			return len;
+		}
 
-		std::string ret;
-		while(iconvInSize) {
-			if( ::iconv(cd, &iconvIn, &iconvInSize, &iconvOut, &iconvOutSize) == (size_t) -1 ) {
-				rpg2k_analyze_assert(false);
+		uint8_t const* in = reinterpret_cast< uint8_t const* >(src);
+		uint8_t const* const end = in + len;
+		uint8_t* out = reinterpret_cast< uint8_t* >(dst);
+		while(true) {
+			copyASCII(in, end, out);
+			if(in == end) break;
+
+			unsigned const c = *in++;
+			out = encodeUTF8( decodeCP932(c, in, end), out );
+		}
+		return out - reinterpret_cast< uint8_t* >(dst);
+	}
+	std::size_t Encode::toRPG2k(char const* const src, std::size_t const len, char* const dst) const
+	{
+		if(!systemIsUTF8_) {
+			std::memcpy(dst, src, len);
+			return len;
+		}
+
+		uint8_t const* in = reinterpret_cast< uint8_t const* >(src);
+		uint8_t const* const end = in + len;
+		uint8_t* out = reinterpret_cast< uint8_t* >(dst);
+		while(true) {
+			copyASCII(in, end, out);
+			if(in == end) break;
+
+			unsigned const c = *in++;
+			uint16_t const code = toCP932( decodeUTF8(c, in, end) );
+			if(!code) *out++ = CP932_REPLACEMENT;
+			else if(code <= 0xff) *out++ = code;
+			else {
+				*out++ = code >> 8;
+				*out++ = code & 0xff;
 			}
-			ret.append(iconvBuff, BUFF_SIZE-iconvOutSize);
-			iconvOutSize = BUFF_SIZE;
 		}
-		return ret;
+		return out - reinterpret_cast< uint8_t* >(dst);
+	}
+	std::size_t Encode::toCodePoint(char const* const src, std::size_t const len, uint32_t* const dst) const
+	{
+		uint8_t const* in = reinterpret_cast< uint8_t const* >(src);
+		uint8_t const* const end = in + len;
+		uint32_t* out = dst;
+		while(in < end) {
+			unsigned const c = *in++;
+			if( !(c & 0x80) ) *out++ = c;
+			else *out++ = systemIsUTF8_ ? decodeUTF8(c, in, end) : decodeCP932(c, in, end);
+		}
+		return out - dst;
 	}
 } // namespace rpg2k
@@ -3,35 +3,54 @@
 
 #include "Define.hpp"
 #include <boost/noncopyable.hpp>
-#include <iconv.h>
-#include <stdexcept>
+#include <cstddef>
+#include <vector>
 
 
 namespace rpg2k
 {
+	/*
+	 * converts between the RPG2k encoding(CP932) and the system encoding(UTF-8 or CP932)
+	 * with the CP932 table in define/CP932.cpp instead of iconv
+	 */
 	class Encode : boost::noncopyable
 	{
+	public:
+		// a system string is at most this many times as long as the RPG2k string
+		enum { SYSTEM_EXPANSION = 3, };
 	private:
-		enum { BUFF_SIZE = 1024, };
-
 		static std::string const SYSTEM_ENCODE;
-		static std::string const RPG2K_ENCODE;
 
-		::iconv_t toSystem_, toRPG2k_;
 		std::string sysEncode_;
+		bool systemIsUTF8_;
+
+		// unicode -> CP932, 256 code point pages. page 0 of fromUnicode_ is the unmapped page
+		std::vector<uint16_t> fromUnicode_;
+		uint16_t fromUnicodePage_[0x100];
+
+		void addCP932(uint16_t code, uint16_t cp932);
+		uint16_t toCP932(uint32_t code) const;
 	protected:
 		Encode();
 		~Encode();
-
-		static std::string convertString(std::string const& src, iconv_t cd);
-		static iconv_t openConverter(std::string const& to, std::string const& from);
 	public:
 		static Encode& instance();
 
-		SystemString toSystem( RPG2kString const& src) const { return convertString(src, toSystem_); }
-		 RPG2kString toRPG2k (SystemString const& src) const { return convertString(src, toRPG2k_ ); }
+		SystemString toSystem( RPG2kString const& src) const;
+		 RPG2kString toRPG2k (SystemString const& src) const;
+
+		/*
+		 * streaming versions writing to dst and returning the written length
+		 * dst needs room for len * SYSTEM_EXPANSION bytes for toSystem,
+		 * len bytes for toRPG2k and len code points for toCodePoint
+		 */
+		std::size_t toSystem(char const* src, std::size_t len, char* dst) const;
+		std::size_t toRPG2k (char const* src, std::size_t len, char* dst) const;
+		// system string to unicode code points
+		std::size_t toCodePoint(char const* src, std::size_t len, uint32_t* dst) const;
 
 		std::string const& systemEncoding() const { return sysEncode_; }
+		bool systemIsUTF8() const { return systemIsUTF8_; }
 	}; // class Encode
 } // namespace rpg2k
 
@@ -6,61 +6,31 @@ namespace rpg2k
 {
 	namespace structure
 	{
-		Instruction::Instruction()
-		: code_(-1)
-		{
-		}
-		Instruction::Instruction(StreamReader& s)
-		{
-			code_ = s.ber();
-			nest_ = s.ber();
-
-			Binary b;
-			s.get(b);
-			stringArgument_ = static_cast<RPG2kString>(b);
-
-			int argNum = s.ber();
-
-			argument_.resize(argNum, VAR_DEF_VAL);
-			for(int i = 0; i < argNum; i++) argument_[i] = s.ber();
-		}
-		Instruction::Instruction(Instruction const& src)
-		: code_(src.code_), nest_(src.nest_)
-		, stringArgument_(src.stringArgument_), argument_(src.argument_)
-		{
-		}
-
-		int32_t Instruction::at(unsigned index) const
-		{ rpg2k_assert( index < argument_.size() ); return argument_[index]; }
-		int32_t Instruction::operator [](unsigned index) const
-		{ rpg2k_assert( index < argument_.size() ); return argument_[index]; }
-		int32_t& Instruction::at(unsigned index)
-		{ rpg2k_assert( index < argument_.size() ); return argument_[index]; }
-		int32_t& Instruction::operator [](unsigned index)
-		{ rpg2k_assert( index < argument_.size() ); return argument_[index]; }
-
 		unsigned Instruction::serializedSize() const
 		{
+			unsigned const strSize = string().size();
 			unsigned ret =
-				berSize(code_) + berSize(nest_) +
-				berSize( stringArgument_.size() ) + stringArgument_.size() +
-				berSize( argument_.size() );
-			for(unsigned i = 0; i < argument_.size(); i++) ret += berSize(argument_[i]);
+				berSize( code() ) + berSize( nest() ) +
+				berSize(strSize) + strSize +
+				berSize( argNum() );
+			for(unsigned i = 0; i < argNum(); i++) ret += berSize( at(i) );
 			return ret;
 		}
 		void Instruction::serialize(StreamWriter& s) const
 		{
-			s.add( serializedSize() );
-
-			s.setBER(code_);
-			s.setBER(nest_);
-			s.setBER( stringArgument_.size() ); s.write(stringArgument_);
-			s.setBER( argument_.size() );
-			for(unsigned i = 0; i < argument_.size(); i++) s.setBER(argument_[i]);
+			s.setBER( code() );
+			s.setBER( nest() );
+			RPG2kString const& str = string();
+			s.setBER( str.size() );
+			if( !str.empty() ) s.write( reinterpret_cast<uint8_t const*>( str.data() ), str.size() );
+			s.setBER( argNum() );
+			for(unsigned i = 0; i < argNum(); i++) s.setBER( at(i) );
 		}
 
 		Event::Event(Binary const& b)
 		{
+			argBegin_.push_back(0);
+
 			StreamReader s( std::auto_ptr<StreamInterface>( new BinaryReaderNoCopy(b) ) );
 			init(s);
 		}
@@ -68,37 +38,86 @@ namespace rpg2k
 		void Event::init(StreamReader& s)
 		{
 			while( !s.eof() ) {
-				data_.push_back( Instruction(s) );
-				if(data_.back().code() == 12110) { // check for label
-					if( !label_.insert( std::make_pair(data_.back()[0], data_.size() - 1) ).second ) {
+				code_.push_back( s.ber() );
+				nest_.push_back( s.ber() );
+
+				unsigned const strSize = s.ber();
+				strings_.push_back( RPG2kString() );
+				if(strSize) {
+					strings_.back().resize(strSize);
+					s.read( reinterpret_cast<uint8_t*>(&strings_.back()[0]), strSize );
+				}
+
+				unsigned const argNum = s.ber();
+				for(unsigned i = 0; i < argNum; i++) args_.push_back( s.ber() );
+				argBegin_.push_back( args_.size() );
+
+				if(code_.back() == 12110) { // check for label
+					if( !label_.insert( std::make_pair( (*this)[size() - 1][0], size() - 1 ) ).second ) {
 						rpg2k_assert(false);
 					}
 				}
 			}
+
+			buildJumpTable();
+		}
+		void Event::buildJumpTable()
+		{
+			nestTable_.clear();
+			for(unsigned i = 0; i < size(); i++) {
+				unsigned const nest = nest_[i];
+				if( nest >= nestTable_.size() ) nestTable_.resize(nest + 1);
+				nestTable_[nest].push_back(i);
+			}
+
+			groupEnd_.resize( size() );
+			for(unsigned i = size(); i > 0; i--) {
+				unsigned const cur = i - 1;
+				groupEnd_[cur] = (
+					( i < size() ) &&
+					( code_[cur] % 10000 / 10 == code_[i] % 10000 / 10 )
+				)? groupEnd_[i] : i;
+			}
+		}
+
+		unsigned Event::findNest(unsigned const from, unsigned const nest) const
+		{
+			if( nest >= nestTable_.size() ) return size();
+
+			std::vector<unsigned> const& list = nestTable_[nest];
+			std::vector<unsigned>::const_iterator const it = std::lower_bound( list.begin(), list.end(), from );
+			return ( it == list.end() )? size() : *it;
+		}
+		unsigned Event::nextNest(unsigned const index) const
+		{
+			return findNest( index + 1, nest_[index] );
 		}
 
 		unsigned Event::serializedSize() const
 		{
-			unsigned ret = 0;
-			for(unsigned i = 0; i < data_.size(); i++) ret += data_[i].serializedSize();
-			return ret;
+			return serializedSize(0);
 		}
 		unsigned Event::serializedSize(unsigned offset) const
 		{
 			unsigned ret = 0;
-			for(unsigned i = offset; i < data_.size(); i++) ret += data_[i].serializedSize();
+			for(unsigned i = offset; i < size(); i++) ret += (*this)[i].serializedSize();
 			return ret;
 		}
 		void Event::serialize(StreamWriter& s) const
 		{
-			s.add( serializedSize() );
-
-			for(unsigned i = 0; i < data_.size(); i++) data_[i].serialize(s);
+			for(unsigned i = 0; i < size(); i++) (*this)[i].serialize(s);
 		}
 
 		void Event::resize(unsigned size)
 		{
-			data_.resize(size);
+			if( size < this->size() ) args_.resize(argBegin_[size]);
+			// appended instructions have no code, string nor arguments
+			code_.resize(size, unsigned(-1));
+			nest_.resize(size, 0);
+			strings_.resize(size);
+			argBegin_.resize( size + 1, args_.size() );
+
+			buildJumpTable();
 		}
 	} // namespace structure
 } // namespace rpg2k
@@ -3,7 +3,7 @@
 
 #include "Define.hpp"
 
-#include <deque>
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <vector>
@@ -18,38 +18,30 @@ namespace rpg2k
 		class StreamReader;
 		class StreamWriter;
 
+		class Event;
+
+		// lightweight view of an instruction stored in Event
 		class Instruction
 		{
 		private:
-			unsigned code_, nest_;
-
-			RPG2kString stringArgument_;
-			std::vector<int32_t> argument_;
+			Event const* owner_;
+			unsigned index_;
 		public:
-			Instruction();
-			Instruction(StreamReader& s);
-			Instruction(Instruction const& src);
-
-			unsigned code() const { return code_; }
-			void setCode(unsigned c) { code_ = c; }
+			Instruction(Event const& owner, unsigned index) : owner_(&owner), index_(index) {}
 
-			unsigned nest() const { return nest_; }
-			void setNest(unsigned n) { nest_ = n; }
+			unsigned code() const;
+			unsigned nest() const;
 
-			RPG2kString const& string() const { return stringArgument_; }
-			void setString(RPG2kString const& str) { stringArgument_ = str; }
-			operator RPG2kString const&() const { return stringArgument_; }
+			RPG2kString const& string() const;
+			operator RPG2kString const&() const { return string(); }
 
-			std::vector<int32_t> const& args() const { return argument_; }
-			std::vector<int32_t> args() { return argument_; }
+			// argNum() arguments, NULL when there are none
+			int32_t const* args() const;
 
 			int32_t at(unsigned index) const;
-			int32_t operator [](unsigned index) const;
-			int32_t& at(unsigned index);
-			int32_t& operator [](unsigned index);
+			int32_t operator [](unsigned index) const { return at(index); }
 
-			unsigned argNum() const { return argument_.size(); }
-			void addArg(int32_t arg) { argument_.push_back(arg); }
+			unsigned argNum() const;
 
 			unsigned serializedSize() const;
 			void serialize(StreamWriter& s) const;
@@ -60,30 +52,69 @@ namespace rpg2k
 
 		class Event
 		{
+			friend class Instruction;
 		protected:
 			void init(StreamReader& s);
 		public:
-			Event() {}
+			Event() { argBegin_.push_back(0); }
 			Event(Binary const& b);
 
-			Instruction const& operator [](unsigned index) const { return data_[index]; }
+			Instruction operator [](unsigned index) const
+			{
+				rpg2k_assert( index < size() );
+				return Instruction(*this, index);
+			}
 
-			unsigned size() const { return data_.size(); }
+			unsigned size() const { return code_.size(); }
 			void resize(unsigned num);
 
 			unsigned serializedSize() const;
 			unsigned serializedSize(unsigned offset) const;
 			void serialize(StreamWriter& s) const;
 
-			typedef std::deque<Instruction> Data;
-			// Data const& data() const { return data_; }
-
 			typedef std::map<unsigned, unsigned> LabelTable;
 			LabelTable const& labelTable() const { return label_; }
+
+			// first index at or after "from" with nest level "nest", size() if not found
+			unsigned findNest(unsigned from, unsigned nest) const;
+			// next index with the same nest level as "index", size() if not found
+			unsigned nextNest(unsigned index) const;
+			// first index after "index" whose code group(code % 10000 / 10) differs, size() if not found
+			unsigned groupEnd(unsigned index) const { return groupEnd_[index]; }
 		private:
-			Data data_;
+			// instructions are stored as arrays of each field.
+			// arguments of instruction i are in [argBegin_[i], argBegin_[i + 1])
+			std::vector<unsigned> code_, nest_;
+			std::vector<unsigned> argBegin_;
+			std::vector<int32_t> args_;
+			std::vector<RPG2kString> strings_;
+
 			LabelTable label_;
+
+			// jump table computed with the instructions
+			typedef std::vector< std::vector<unsigned> > NestTable;
+			NestTable nestTable_; // indexes of each nest level
+			std::vector<unsigned> groupEnd_;
+
+			void buildJumpTable();
 		}; // class Event
+
+		inline unsigned Instruction::code() const { return owner_->code_[index_]; }
+		inline unsigned Instruction::nest() const { return owner_->nest_[index_]; }
+		inline RPG2kString const& Instruction::string() const { return owner_->strings_[index_]; }
+		inline int32_t const* Instruction::args() const
+		{
+			return argNum() ? &owner_->args_[ owner_->argBegin_[index_] ] : NULL;
+		}
+		inline unsigned Instruction::argNum() const
+		{
+			return owner_->argBegin_[index_ + 1] - owner_->argBegin_[index_];
+		}
+		inline int32_t Instruction::at(unsigned const index) const
+		{
+			rpg2k_assert( index < argNum() );
+			return owner_->args_[owner_->argBegin_[index_] + index];
+		}
 	} // namespace structure
 } // namespace rpg2k
 
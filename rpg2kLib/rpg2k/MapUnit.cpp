@@ -1,5 +1,6 @@
 #include "Debug.hpp"
 #include "MapUnit.hpp"
+#include "Stream.hpp"
 
 #include <sstream>
 
@@ -21,14 +22,29 @@ namespace rpg2k
 		MapUnit::MapUnit(SystemString const& dir, unsigned id)
 		: Base( dir, SystemString() ), id_(id)
 		{
-			std::ostringstream ss;
-			ss << "Map" << std::setfill('0') << std::setw(4) << id << ".lmu";
-			setFileName( ss.str() );
+			setFileName( unitFileName(id) );
 
 			checkExists();
 
 			load();
 		}
+		SystemString MapUnit::unitFileName(unsigned const id)
+		{
+			std::ostringstream ss;
+			ss << "Map" << std::setfill('0') << std::setw(4) << id << ".lmu";
+			return ss.str();
+		}
+		unsigned MapUnit::chipSetID(SystemString const& dir, unsigned const id)
+		{
+			SystemString const path = SystemString(dir).append(PATH_SEPR).append( unitFileName(id) );
+			structure::StreamReader s(path);
+			if( !s.checkHeader("LcfMapUnit") ) { rpg2k_assert(false); return 1; }
+
+			// the chip set ID is the first field and omitted when it is the default
+			if( s.ber() != 1 ) return 1;
+			s.ber(); // size
+			return s.ber();
+		}
 		void MapUnit::loadImpl()
 		{
 			rpg2k_assert( rpg2k::within<unsigned>(ID_MIN, id_, MAP_UNIT_MAX+1) );
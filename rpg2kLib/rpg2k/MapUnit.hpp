@@ -28,6 +28,11 @@ namespace rpg2k
 			MapUnit(SystemString const& dir, unsigned id);
 			virtual ~MapUnit();
 
+			// file name of map id ( "MapNNNN.lmu" )
+			static SystemString unitFileName(unsigned id);
+			// chip set ID of map id, only the head of the file is read
+			static unsigned chipSetID(SystemString const& dir, unsigned id);
+
 
 			unsigned id() const { return id_; }
 
@@ -4,8 +4,6 @@
 #include "define/Define.hpp"
 
 #include <algorithm>
-#include <sstream>
-#include <stack>
 
 #include <cctype>
 #include <cstdio>
@@ -25,33 +23,59 @@ namespace rpg2k
 			if(fp == NULL) return false;
 			else { std::fclose(fp); return true; }
 		}
+		unsigned fileSize(SystemString const& fileName)
+		{
+			FILE* fp = std::fopen( fileName.c_str(), "rb");
+			if(fp == NULL) return 0;
+
+			std::fseek(fp, 0, SEEK_END);
+			long const ret = std::ftell(fp);
+			std::fclose(fp);
+			return (ret < 0)? 0 : ret;
+		}
 
 		Base::Base(SystemString const& dir)
-		: fileDir_(dir)
+		: fileDir_(dir), data_( new SharedData(new Data) ), dataOwner_(true)
 		{
 			checkExists();
 		}
 		Base::Base(SystemString const& dir, SystemString const& name)
-		: fileDir_(dir), fileName_(name)
+		: fileDir_(dir), fileName_(name), data_( new SharedData(new Data) ), dataOwner_(true)
 		{
 			checkExists();
 		}
 
+		void Base::detach()
+		{
+			if( data_.unique() ) { dataOwner_ = true; return; }
+
+			std::auto_ptr<Data> copy( new Data(*data_->data) );
+			if(dataOwner_) {
+				boost::shared_ptr<SharedData> own( new SharedData( data_->data.release() ) );
+				data_->data = copy;
+				data_ = own;
+			} else {
+				data_.reset( new SharedData( copy.release() ) );
+				dataOwner_ = true;
+			}
+		}
+
 		void Base::reset()
 		{
 			boost::ptr_vector<Descriptor> const& info = descriptor();
+			Data& dst = data();
 			for(unsigned int i = 0; i < info.size(); i++) {
-				data_.push_back( std::auto_ptr<Element>( new Element( info[i] ) ) );
+				dst.push_back( std::auto_ptr<Element>( new Element( info[i] ) ) );
 			}
 		}
 
 		Element& Base::operator [](unsigned index)
 		{
-			return data_.front().toArray1D()[index];
+			return data().front().toArray1D()[index];
 		}
 		Element const& Base::operator [](unsigned index) const
 		{
-			return data_.front().toArray1D()[index];
+			return data().front().toArray1D()[index];
 		}
 
 		boost::ptr_vector<Descriptor> const& Base::descriptor() const
@@ -79,8 +103,9 @@ namespace rpg2k
 			}
 
 			boost::ptr_vector<Descriptor> const& info = descriptor();
+			Data& dst = data();
 			for(unsigned int i = 0; i < info.size(); i++) {
-				data_.push_back( std::auto_ptr<Element>( new Element(info[i], s) ) );
+				dst.push_back( std::auto_ptr<Element>( new Element(info[i], s) ) );
 			}
 
 			rpg2k_assert( s.eof() );
@@ -94,10 +119,16 @@ namespace rpg2k
 			structure::StreamWriter s(filename);
 			serialize(s);
 		}
-		void Base::serialize(structure::StreamWriter& s)
+		void Base::serialize(structure::StreamWriter& s) const
 		{
 			s.setHeader( header() );
-			for(boost::ptr_vector<Element>::const_iterator it = data_.begin(); it < data_.end(); ++it) {
+			// size every element first so that the output is allocated once
+			unsigned size = s.tell();
+			for(Data::const_iterator it = data().begin(); it < data().end(); ++it) {
+				size += it->serializedSize();
+			}
+			s.resize(size);
+			for(Data::const_iterator it = data().begin(); it < data().end(); ++it) {
 				it->serialize(s);
 			}
 		}
@@ -112,7 +143,7 @@ namespace rpg2k
 			isArray_.insert("Array2D");
 
 			#define PP_insert(arg) \
-				defineText_.insert( std::make_pair( RPG2kString( #arg ), define::arg ) )
+				defineTable_.insert( std::make_pair( RPG2kString( #arg ), &define::arg ) )
 			PP_insert(EventState);
 			PP_insert(LcfDataBase);
 			PP_insert(LcfMapTree);
@@ -145,139 +176,44 @@ namespace rpg2k
 
 		void DefineLoader::load(boost::ptr_vector<structure::Descriptor>& dst, RPG2kString const& name)
 		{
-			DefineText::const_iterator it = defineText_.find(name);
-			rpg2k_assert( it != defineText_.end() );
-			std::istringstream stream(it->second);
-			std::deque<RPG2kString> token;
-			toToken(token, stream);
-			parse(dst, token);
+			DefineTable::const_iterator it = defineTable_.find(name);
+			rpg2k_assert( it != defineTable_.end() );
+			define::Schema const& schema = *it->second;
+			for(unsigned i = 0; i < schema.fieldNum; i++) {
+				dst.push_back( std::auto_ptr<Descriptor>( create(schema.field[i]) ) );
+			}
 		}
 
-		// parser for define Stream
-
-		#define nextToken(curType) prev = curType; continue
-
-		void DefineLoader::parse(boost::ptr_vector<structure::Descriptor>& dst
-		, std::deque<RPG2kString> const& token)
+		Descriptor* DefineLoader::create(define::Field const& f)
 		{
-			bool blockComment = false;
-			unsigned int streamComment = 0, line = 1, col = 0;
-			RPG2kString typeName;
-
-			enum TokenType
-			{
-				OPEN_INDEX = 0, INDEX, CLOSE_INDEX1, CLOSE_INDEX2,
-				TYPE, NAME, EQUALS, DEFAULT,
-				OPEN_STRUCT, CLOSE_STRUCT,
-				EXP_END,
-			} prev = EXP_END;
-
+			RPG2kString const typeName(f.type);
 			using structure::ArrayDefineType;
-			std::stack< ArrayDefineType* > nest;
-
-			// if success continue else error
-			for(std::deque<RPG2kString>::const_iterator it = token.begin(); it < token.end(); ++it) {
-				if(*it == "\n") { blockComment = false; line++; continue;
-				} else if(blockComment) { continue;
-				} else if(streamComment) {
-					if( (*it == "*") && ( *(++it) == "/" ) ) { streamComment--; }
-					continue;
-				} else if(*it == "/") {
-					++it;
-					if(*it == "*") { streamComment++; continue; }
-					else if(*it == "/") { blockComment = true; continue; }
-				} else if( nest.empty() ) switch(prev) {
-					case TYPE: nextToken(NAME);
-					case NAME:
-						if(*it == ";") {
-							dst.push_back( std::auto_ptr<Descriptor>( new Descriptor(typeName) ) );
-							nextToken(EXP_END);
-						} else if( isArray(typeName) && (*it == "{") ) {
-							structure::ArrayDefinePointer arrayDef(new ArrayDefineType);
-							ArrayDefineType* p = arrayDef.get();
-
-							dst.push_back(
-								std::auto_ptr<Descriptor>( new Descriptor(typeName, arrayDef) ) );
-							nest.push(p);
-
-							nextToken(OPEN_STRUCT);
-						}
-						break;
-					case CLOSE_STRUCT:
-						if(*it == ";") { nextToken(EXP_END); } else break;
-					case EXP_END:
-						typeName = *it;
-						// cout << typeName << endl;
-						nextToken(TYPE);
-					default: break;
-				} else switch(prev) {
-					case OPEN_INDEX: {
-						std::istringstream ss(*it);
-						ss >> col;
-						rpg2k_assert( nest.top()->find(col) == nest.top()->end() );
-						nextToken(INDEX);
-					}
-					case INDEX:
-						if(*it == "]") { nextToken(CLOSE_INDEX1); } else break;
-					case CLOSE_INDEX1:
-						if(*it == ":") { nextToken(CLOSE_INDEX2); } else break;
-					case CLOSE_INDEX2:
-						typeName = *it;
-						nextToken(TYPE);
-					case TYPE:
-						nextToken(NAME);
-					case NAME:
-						if(*it == "=") { nextToken(EQUALS);
-						} else if(*it == ";") {
-							if( isArray(typeName) ) {
-								boost::ptr_vector<Descriptor> const& def = get(typeName);
-								nest.top()->insert( col,
-									std::auto_ptr<Descriptor>( new Descriptor(
-										structure::ElementType::instance().toString( def[0].type() ),
-										structure::ArrayDefinePointer( new ArrayDefineType( def[0].arrayDefine() ) ) ) ) );
-							} else nest.top()->insert( col, std::auto_ptr<Descriptor>( new Descriptor(typeName) ) );
-
-							nextToken(EXP_END);
-						} else if( (*it == "{") && isArray(typeName) ) {
-							structure::ArrayDefinePointer arrayDef(new ArrayDefineType);
-							ArrayDefineType* p = arrayDef.get();
-
-							nest.top()->insert( col, std::auto_ptr<Descriptor>( new  Descriptor(typeName, arrayDef) ) );
-							nest.push(p);
 
-							nextToken(OPEN_STRUCT);
-						} else break;
-					case EQUALS:
-						if( isArray(typeName) )
-							nest.top()->insert( col,
-								std::auto_ptr<Descriptor>( new Descriptor( typeName,
-								structure::ArrayDefinePointer( new ArrayDefineType( arrayDefine(*it) ) ) ) ) );
-						else nest.top()->insert( col, std::auto_ptr<Descriptor>( new Descriptor(typeName, *it) ) );
-						nextToken(DEFAULT);
-					case DEFAULT:
-						if(*it == ";") { nextToken(EXP_END); } else break;
-					case OPEN_STRUCT:
-						if(*it == "[") { nextToken(OPEN_INDEX); }
-						else if(*it == "}") { nest.pop(); nextToken(CLOSE_STRUCT); }
-						else break;
-					case CLOSE_STRUCT:
-						if(*it == ";") { nextToken(EXP_END); } else break;
-					case EXP_END:
-						if(*it == "[") { nextToken(OPEN_INDEX); }
-						else if(*it == "}") { nest.pop(); nextToken(CLOSE_STRUCT); }
-						else break;
-					default: break;
+			if( !isArray(typeName) ) {
+				return (f.defaultValue == NULL)
+					? new Descriptor(typeName)
+					: new Descriptor( typeName, RPG2kString(f.defaultValue) );
+			} else if(f.defaultValue != NULL) {
+				// "Array2D info = EventState;"
+				return new Descriptor( typeName, structure::ArrayDefinePointer(
+					new ArrayDefineType( arrayDefine(f.defaultValue) ) ) );
+			} else if( (typeName == "Array1D") || (typeName == "Array2D") ) {
+				structure::ArrayDefinePointer arrayDef(new ArrayDefineType);
+				for(unsigned i = 0; i < f.memberNum; i++) {
+					unsigned index = f.member[i].index;
+					rpg2k_assert( arrayDef->find(index) == arrayDef->end() );
+					arrayDef->insert( index, std::auto_ptr<Descriptor>( create(f.member[i]) ) );
 				}
-
-				cerr << "Error at line: " << line << endl;
-				rpg2k_assert(false);
+				return new Descriptor(typeName, arrayDef);
+			} else {
+				// "Music music;"
+				Descriptor const& def = get(typeName).front();
+				return new Descriptor(
+					structure::ElementType::instance().toString( def.type() ),
+					structure::ArrayDefinePointer( new ArrayDefineType( def.arrayDefine() ) ) );
 			}
-
-			rpg2k_assert(streamComment == 0);
 		}
 
-		#undef nextToken
-
 		void DefineLoader::toToken(std::deque<RPG2kString>& token, std::istream& stream)
 		{
 			RPG2kString strBuf;
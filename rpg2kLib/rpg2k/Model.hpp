@@ -12,15 +12,18 @@
 #include "Element.hpp"
 
 #include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/shared_ptr.hpp>
 
 
 namespace rpg2k
 {
+	namespace define { struct Field; struct Schema; }
 	namespace structure { class StreamWriter; }
 
 	namespace model
 	{
 		bool fileExists(SystemString const& fileName);
+		unsigned fileSize(SystemString const& fileName); // 0 if it doesn't exist
 
 		class Base
 		{
@@ -28,7 +31,20 @@ namespace rpg2k
 			bool exists_;
 
 			SystemString fileDir_, fileName_;
-			boost::ptr_vector<structure::Element> data_;
+
+			typedef boost::ptr_vector<structure::Element> Data;
+			/*
+			 * element tree shared between copies until one of them is modified.
+			 * the owner of the tree keeps it on modification and the others get a clone
+			 * so that references to the owner's elements stay valid.
+			 */
+			struct SharedData
+			{
+				std::auto_ptr<Data> data;
+				SharedData(Data* d) : data(d) {}
+			};
+			boost::shared_ptr<SharedData> data_;
+			bool dataOwner_;
 
 			virtual void loadImpl() = 0;
 			virtual void saveImpl() = 0;
@@ -37,8 +53,10 @@ namespace rpg2k
 			virtual char const* defaultName() const = 0;
 		protected:
 			void setFileName(SystemString const& name) { fileName_ = name; }
-			boost::ptr_vector<structure::Element>& data() { return data_; }
-			boost::ptr_vector<structure::Element> const& data() const { return data_; }
+			Data& data() { detach(); return *data_->data; }
+			Data const& data() const { return *data_->data; }
+			// O(1) copy of element tree
+			void share(Base const& src) { data_ = src.data_; dataOwner_ = false; }
 
 			void checkExists();
 
@@ -54,6 +72,13 @@ namespace rpg2k
 		public:
 			virtual ~Base() {}
 
+			/*
+			 * write barrier. call it before writing through references kept into the elements,
+			 * such writes don't reach data() and would show up in the copies sharing the tree.
+			 * the owner keeps its tree so the references stay valid.
+			 */
+			void detach();
+
 			bool exists() const { return exists_; }
 
 			void reset();
@@ -71,7 +96,7 @@ namespace rpg2k
 			void saveAs(SystemString const& filename);
 			void save() { saveAs( fullPath() ); }
 
-			void serialize(structure::StreamWriter& s);
+			void serialize(structure::StreamWriter& s) const;
 		}; // class Base
 
 		class DefineLoader
@@ -79,11 +104,11 @@ namespace rpg2k
 		private:
 			typedef std::map< RPG2kString, boost::ptr_vector<structure::Descriptor> > DefineBuffer;
 			DefineBuffer defineBuff_;
-			typedef std::map<RPG2kString, const char*> DefineText;
-			DefineText defineText_;
+			typedef std::map<RPG2kString, define::Schema const*> DefineTable;
+			DefineTable defineTable_;
 			std::set<RPG2kString> isArray_;
 		protected:
-			void parse(boost::ptr_vector<structure::Descriptor>& dst, std::deque<RPG2kString> const& token);
+			structure::Descriptor* create(define::Field const& f);
 			void load(boost::ptr_vector<structure::Descriptor>& dst, RPG2kString const& name);
 
 			DefineLoader();
@@ -43,6 +43,25 @@ namespace
 	using rpg2k::structure::Array1D;
 	using rpg2k::structure::Array2D;
 	using rpg2k::structure::EventState;
+	using rpg2k::structure::Event;
+
+	typedef std::map< unsigned, std::vector<unsigned> > DependencyTable;
+
+	void collectDependents(std::set<unsigned>& dst, DependencyTable const& table, std::set<unsigned> const& ids)
+	{
+		for(std::set<unsigned>::const_iterator it = ids.begin(); it != ids.end(); ++it) {
+			DependencyTable::const_iterator const found = table.find(*it);
+			if( found != table.end() ) dst.insert( found->second.begin(), found->second.end() );
+		}
+	}
+	void collectDependents(std::set<unsigned>& dst, DependencyTable const& table)
+	{
+		for(DependencyTable::const_iterator it = table.begin(); it != table.end(); ++it) {
+			dst.insert( it->second.begin(), it->second.end() );
+		}
+	}
+
+	unsigned const CODE_LOCATE_MOVE = 10810; // teleport to a fixed map
 } // namespace
 
 namespace rpg2k
@@ -52,7 +71,11 @@ namespace rpg2k
 		Project::Project(SystemString baseDir)
 		: baseDir_(baseDir)
 		, ldb_(baseDir), lmt_(baseDir)
+		, lmuSize_(0), lmuBudget_(MAP_UNIT_CACHE_SIZE), prefetchMapID_(INVALID_ID)
 		{
+			pageDependency_.lmu = NULL;
+			pageDependency_.mapID = 0;
+
 			init();
 		}
 
@@ -62,14 +85,13 @@ namespace rpg2k
 			lastSaveDataStamp_ = 0.0;
 			lastSaveDataID_ = ID_MIN;
 
-			lsd_.push_back( std::auto_ptr<SaveData>( new SaveData() ) ); // set LcfSaveData buffer
 			for(unsigned i = ID_MIN; i <= SAVE_DATA_MAX; i++) {
-				lsd_.push_back( std::auto_ptr<SaveData>( new SaveData(baseDir_, i) ) );
+				lsdPreview_.push_back( std::auto_ptr<SaveDataPreview>( new SaveDataPreview(baseDir_, i) ) );
 
-				if( lsd_.back().exists() ) {
+				if( lsdPreview_.back().exists() ) {
 					// TODO: caclating current time
 					// Time Stamp Format: see http://support.microsoft.com/kb/210276
-					double const cur = lsd_.back()[100].toArray1D()[1].to<double>();
+					double const cur = lsdPreview_.back().timeStamp();
 					if(cur > lastSaveDataStamp_) {
 						lastSaveDataID_ = i;
 						lastSaveDataStamp_ = cur;
@@ -83,7 +105,16 @@ namespace rpg2k
 		SaveData& Project::getLSD(unsigned const id)
 		{
 			rpg2k_assert( rpg2k::within<unsigned>(ID_MIN, id, SAVE_DATA_MAX+1) );
-			return lsd_[id];
+			SaveDataTable::iterator const it = lsdSlot_.find(id);
+			if( it == lsdSlot_.end() ) {
+				return *lsdSlot_.insert( id, std::auto_ptr<SaveData>(
+					new SaveData(baseDir_, id) ) ).first->second;
+			} else return *it->second;
+		}
+		SaveDataPreview const& Project::getLSDPreview(unsigned const id) const
+		{
+			rpg2k_assert( rpg2k::within<unsigned>(ID_MIN, id, SAVE_DATA_MAX+1) );
+			return lsdPreview_[id - ID_MIN];
 		}
 
 		unsigned Project::currentMapID()
@@ -95,9 +126,84 @@ namespace rpg2k
 		{
 			MapUnitTable::iterator const it = lmu_.find(id);
 			if( it == lmu_.end() ) {
-				return *lmu_.insert( id, std::auto_ptr<MapUnit>(
-					new MapUnit( gameDir(), id ) ) ).first->second;
-			} else return *it->second;
+				MapUnit& ret = loadLMU( id, fileSize( SystemString( gameDir() ).append(PATH_SEPR).append( MapUnit::unitFileName(id) ) ) );
+				shrinkLMU(id);
+				return ret;
+			}
+			// move to the most recently used end
+			for(MapUnitOrder::iterator i = lmuOrder_.begin(); i != lmuOrder_.end(); ++i) {
+				if(i->first == id) { lmuOrder_.splice(lmuOrder_.end(), lmuOrder_, i); break; }
+			}
+			return *it->second;
+		}
+		MapUnit& Project::loadLMU(unsigned const id, unsigned const size)
+		{
+			MapUnit& ret = *lmu_.insert( id, std::auto_ptr<MapUnit>(
+				new MapUnit( gameDir(), id ) ) ).first->second;
+			lmuOrder_.push_back( std::make_pair(id, size) );
+			lmuSize_ += size;
+			return ret;
+		}
+		void Project::shrinkLMU(unsigned const keepID)
+		{
+			// the current map, the requested one and pinned ones stay even if they exceed the budget
+			unsigned const current = currentMapID();
+			MapUnitOrder::iterator it = lmuOrder_.begin();
+			while( (lmuSize_ > lmuBudget_) && ( it != lmuOrder_.end() ) ) {
+				if( (it->first == keepID) || (it->first == current) || lmuPinned_.count(it->first) ) { ++it; continue; }
+
+				lmu_.erase(it->first);
+				lmuSize_ -= it->second;
+				it = lmuOrder_.erase(it);
+			}
+		}
+		void Project::setLMUBudget(unsigned const bytes)
+		{
+			lmuBudget_ = bytes;
+			shrinkLMU(INVALID_ID);
+		}
+
+		unsigned Project::prefetchLMU()
+		{
+			unsigned const current = currentMapID();
+			if( current == INVALID_ID ) return INVALID_ID;
+		// list teleport destinations when the map is changed
+			if(prefetchMapID_ != current) {
+				prefetchMapID_ = current;
+				prefetchQueue_.clear();
+
+				std::set<unsigned> found;
+				Array2D const& events = getLMU(current).event();
+				for(Array2D::ConstIterator ev = events.begin(); ev != events.end(); ++ev) {
+					if( !ev->second->exists() ) continue;
+
+					Array2D const& pages = (*ev->second)[5];
+					for(Array2D::ConstIterator page = pages.begin(); page != pages.end(); ++page) {
+						if( !page->second->exists() ) continue;
+
+						Event const& event = (*page->second)[52];
+						for(unsigned i = 0; i < event.size(); i++) {
+							if( event[i].code() != CODE_LOCATE_MOVE ) continue;
+
+							unsigned const dst = event[i].at(0);
+							if( (dst != current) && found.insert(dst).second ) prefetchQueue_.push_back(dst);
+						}
+					}
+				}
+			}
+			/*
+			 * map units aren't loaded here.
+			 * parsing one stalls the frame as much as loading it on the teleport,
+			 * and the model isn't safe to build on the loader thread.
+			 */
+			while( !prefetchQueue_.empty() ) {
+				unsigned const id = prefetchQueue_.front();
+				prefetchQueue_.pop_front();
+				if( fileSize( SystemString( gameDir() ).append(PATH_SEPR).append( MapUnit::unitFileName(id) ) ) == 0 ) continue;
+
+				return id;
+			}
+			return INVALID_ID;
 		}
 
 		bool Project::canTeleport()
@@ -128,16 +234,15 @@ namespace rpg2k
 		void Project::loadLSD(unsigned const id)
 		{
 			rpg2k_assert( rpg2k::within<unsigned>(ID_MIN, id, SAVE_DATA_MAX+1) );
-			getLSD() = lsd_[id];
+			getLSD() = getLSD(id);
 
 			Array2D const& charsLDB = ldb_.character();
-			Array2D& charsLSD = getLSD().character();
 			charTable_.clear();
 			for(Array2D::ConstIterator it = charsLDB.begin(); it != charsLDB.end(); ++it) {
 				if( !it->second->exists() ) continue;
 
 				charTable_.insert( it->first, std::auto_ptr<Character>(
-					new Character( it->first, *it->second, charsLSD[it->first] ) ) );
+					new Character( it->first, *it->second, getLSD() ) ) );
 			}
 		}
 
@@ -174,8 +279,17 @@ namespace rpg2k
 				i->second->sync();
 			}
 
-			lsd_[id] = lsd;
-			lsd_[id].save();
+			// the slot shares the element tree of the synced lsd, so saving it doesn't copy
+			lsd.sync();
+			SaveDataTable::iterator const it = lsdSlot_.find(id);
+			if( it != lsdSlot_.end() ) {
+				*it->second = lsd;
+				it->second->save();
+			} else {
+				structure::StreamWriter s( SystemString(baseDir_).append(PATH_SEPR).append( SaveData::slotName(id) ) );
+				lsd.serialize(s);
+			}
+			lsdPreview_.replace( id - ID_MIN, std::auto_ptr<SaveDataPreview>( new SaveDataPreview(baseDir_, id) ) );
 		}
 
 		namespace
@@ -263,6 +377,60 @@ namespace rpg2k
 			return NULL;
 		}
 
+		void Project::buildPageDependency(MapUnit const& lmu)
+		{
+			PageDependency& dep = pageDependency_;
+			dep.lmu = &lmu;
+			dep.mapID = lmu.id();
+			dep.flag.clear(); dep.var.clear(); dep.item.clear(); dep.member.clear();
+			dep.event.clear();
+
+			Array2D const& events = lmu[81];
+			for(Array2D::ConstIterator it = events.begin(); it != events.end(); ++it) {
+				if( !it->second->exists() ) continue;
+
+				unsigned const evID = it->first;
+				dep.event.push_back(evID);
+
+				Array2D const& pages = (*it->second)[5];
+				for(Array2D::ConstIterator pIt = pages.begin(); pIt != pages.end(); ++pIt) {
+					if( !pIt->second->exists() ) continue;
+
+					Array1D const& term = (*pIt->second)[2];
+					int const flags = term[1];
+					if( flags & (0x01 << 0) ) dep.flag[ term[2].to<unsigned>() ].push_back(evID);
+					if( flags & (0x01 << 1) ) dep.flag[ term[3].to<unsigned>() ].push_back(evID);
+					if( flags & (0x01 << 2) ) dep.var [ term[4].to<unsigned>() ].push_back(evID);
+					if( flags & (0x01 << 3) ) dep.item[ term[6].to<unsigned>() ].push_back(evID);
+					if( flags & (0x01 << 4) ) dep.member[ term[7].to<unsigned>() ].push_back(evID);
+					// timer condition isn't tracked since timerLeft() is constant for now
+				}
+			}
+		}
+		void Project::dirtyPages(std::set<unsigned>& dst)
+		{
+			MapUnit const& lmu = getLMU();
+			if( (pageDependency_.lmu != &lmu) || (pageDependency_.mapID != lmu.id()) ) {
+				buildPageDependency(lmu);
+			}
+			PageDependency const& dep = pageDependency_;
+
+			SaveData& lsd = getLSD();
+			SaveData::ConditionChange const& change = lsd.conditionChange();
+			if(change.all) dst.insert( dep.event.begin(), dep.event.end() );
+			else {
+				collectDependents(dst, dep.flag, change.flag);
+				collectDependents(dst, dep.var , change.var );
+				collectDependents(dst, dep.item, change.item);
+				// hasItem() also looks at equipments of members
+				if(change.member) {
+					collectDependents(dst, dep.member);
+					collectDependents(dst, dep.item);
+				}
+			}
+			lsd.clearConditionChange();
+		}
+
 		bool Project::equip(unsigned const charID, unsigned const itemID)
 		{
 			DataBase const& ldb = getLDB();
@@ -356,7 +524,7 @@ namespace rpg2k
 				charLSD[61] = charLDB[51].toBinary(); // equip
 
 				charTable_.insert( it->first, std::auto_ptr<Character>(
-					new Character( it->first, charLDB, charLSD ) ) );
+					new Character( it->first, charLDB, lsd ) ) );
 				Character& c = this->character(it->first);
 
 				charLSD[32] = c.exp(level); // experience
@@ -438,8 +606,8 @@ namespace rpg2k
 		}
 
 		Project::Character::Character(unsigned const charID
-		, structure::Array1D const& ldb, structure::Array1D& lsd)
-		: charID_(charID), ldb_(ldb), lsd_(lsd)
+		, structure::Array1D const& ldb, SaveData& lsd)
+		: charID_(charID), ldb_(ldb), saveData_(lsd), lsd_( lsd.character()[charID] )
 		, basicParam_(ldb_[31].toBinary().convert<uint16_t>())
 		, skill_( lsd_[52].toBinary() )
 		, condition_( lsd_[84].toBinary().convert<uint8_t>() )
@@ -449,17 +617,19 @@ namespace rpg2k
 		}
 		void Project::Character::sync()
 		{
-			lsd_[51] = skill_.size();
-			lsd_[52] = Binary(skill_);
+			Array1D& dst = lsd();
+
+			dst[51] = skill_.size();
+			dst[52] = Binary(skill_);
 
-			lsd_[61] = Binary(equip_);
+			dst[61] = Binary(equip_);
 
-			lsd_[81] = conditionStep_.size();
-			lsd_[82] = Binary(conditionStep_);
+			dst[81] = conditionStep_.size();
+			dst[82] = Binary(conditionStep_);
 			std::vector<uint16_t> const conditionClean( condition_.begin()
 			, ++std::find( condition_.rbegin(), condition_.rend(), true ).base() );
-			lsd_[83] = conditionClean.size();
-			lsd_[84] = Binary(conditionClean);
+			dst[83] = conditionClean.size();
+			dst[84] = Binary(conditionClean);
 		}
 
 		bool Project::hasItem(unsigned const id) const
@@ -551,7 +721,7 @@ namespace rpg2k
 			if(nextLv > rpg2k::LV_MAX) { setLevel(rpg2k::LV_MAX); return; }
 
 			unsigned const prevLv = level();
-			lsd_[31] = nextLv;
+			lsd()[31] = nextLv;
 			Array2D const& skillList = ldb_[63];
 			unsigned currentLv = 1;
 			if(prevLv > nextLv) {
@@ -579,7 +749,7 @@ namespace rpg2k
 		{
 			if(val > rpg2k::EXP_MAX) { return setExp(rpg2k::EXP_MAX); }
 
-			lsd_[32] = val;
+			lsd()[32] = val;
 			if( this->canLevelUp() ) {
 				this->addLevel();
 				return true;
@@ -735,7 +905,7 @@ namespace rpg2k
 		{
 			std::map<double, unsigned> tmp;
 			for(unsigned i = 0; i < SAVE_DATA_MAX; i++) {
-				tmp.insert( std::make_pair( i + 1, lsd_[i + 1][100].toArray1D()[1].to<double const&>() ) );
+				tmp.insert( std::make_pair( i + 1, lsdPreview_[i].timeStamp() ) );
 			}
 			std::vector<unsigned> ret;
 			for(std::map<double, unsigned>::iterator i = tmp.begin(); i != tmp.end(); ++i) {
@@ -12,6 +12,9 @@
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/ptr_container/ptr_unordered_map.hpp>
 
+#include <deque>
+#include <list>
+#include <map>
 #include <set>
 
 
@@ -32,6 +35,7 @@ namespace rpg2k
 				unsigned const charID_;
 
 				structure::Array1D const& ldb_;
+				SaveData& saveData_;
 				structure::Array1D& lsd_;
 
 				std::vector<uint16_t> const basicParam_;
@@ -42,8 +46,10 @@ namespace rpg2k
 
 				template<typename T, unsigned LsdID, unsigned LdbID>
 				T const& get() const { return lsd_.exists(LsdID)? lsd_[LsdID] : ldb_[LdbID]; }
+				// writes to lsd_ go through this so that saved slots sharing the tree get their copy first
+				structure::Array1D& lsd() const { saveData_.detach(); return lsd_; }
 			public:
-				Character(unsigned charID, structure::Array1D const& ldb, structure::Array1D& lsd);
+				Character(unsigned charID, structure::Array1D const& ldb, SaveData& lsd);
 
 				RPG2kString const& charSet() const { return get<RPG2kString, 11, 3>(); }
 				RPG2kString const& faceSet() const { return get<RPG2kString, 21, 15>(); }
@@ -52,16 +58,16 @@ namespace rpg2k
 
 				RPG2kString const& name() const { return get<RPG2kString, 1, 1>(); }
 				RPG2kString const& title() const { return get<RPG2kString, 2, 2>(); }
-				void setName(RPG2kString const& val) { lsd_[1] = val; }
-				void setTitle(RPG2kString const& val) { lsd_[2] = val; }
+				void setName(RPG2kString const& val) { lsd()[1] = val; }
+				void setTitle(RPG2kString const& val) { lsd()[2] = val; }
 
 				std::vector<uint8_t>& condition() { return condition_; }
 				std::vector<uint8_t> const& condition() const { return condition_; }
 
 				int hp() const { return lsd_[71]; }
 				int mp() const { return lsd_[72]; }
-				void setHP(unsigned const val) const { lsd_[71] = val; }
-				void setMP(unsigned const val) const { lsd_[72] = val; }
+				void setHP(unsigned const val) const { lsd()[71] = val; }
+				void setMP(unsigned const val) const { lsd()[72] = val; }
 
 				int basicParam(int level, Param::Type t) const;
 				int param(Param::Type t) const;
@@ -95,12 +101,42 @@ namespace rpg2k
 			MapTree  lmt_;
 			typedef boost::ptr_unordered_map<unsigned, MapUnit> MapUnitTable;
 			MapUnitTable lmu_;
-			boost::ptr_vector<SaveData> lsd_;
+			// map ID and file size of loaded map units, least recently used first
+			typedef std::list< std::pair<unsigned, unsigned> > MapUnitOrder;
+			MapUnitOrder lmuOrder_;
+			unsigned lmuSize_, lmuBudget_;
+			// maps the running events point into
+			std::set<unsigned> lmuPinned_;
+			// teleport destinations of prefetchMapID_ not loaded yet
+			unsigned prefetchMapID_;
+			std::deque<unsigned> prefetchQueue_;
+			SaveData lsd_; // current LcfSaveData buffer
+			// save slots are parsed on first access, startup only reads their previews
+			typedef boost::ptr_unordered_map<unsigned, SaveData> SaveDataTable;
+			SaveDataTable lsdSlot_;
+			boost::ptr_vector<SaveDataPreview> lsdPreview_;
 
 			typedef boost::ptr_unordered_map<unsigned, Character> CharacterTable;
 			CharacterTable charTable_;
 			unsigned lastSaveDataID_;
 			double lastSaveDataStamp_;
+
+			// events of a map listed by the switches, variables, items and members their page conditions read
+			struct PageDependency
+			{
+				typedef std::map< unsigned, std::vector<unsigned> > Table;
+
+				MapUnit const* lmu;
+				unsigned mapID;
+				Table flag, var, item, member;
+				std::vector<unsigned> event;
+			};
+			PageDependency pageDependency_;
+
+			void buildPageDependency(MapUnit const& lmu);
+
+			MapUnit& loadLMU(unsigned id, unsigned size);
+			void shrinkLMU(unsigned keepID);
 		protected:
 			void init();
 		public:
@@ -114,17 +150,29 @@ namespace rpg2k
 
 			DataBase const& getLDB() const { return ldb_; }
 			 MapTree const& getLMT() const { return lmt_; }
-			SaveData const& getLSD() const { return lsd_.front(); }
+			SaveData const& getLSD() const { return lsd_; }
+			SaveDataPreview const& getLSDPreview(unsigned id) const;
 
 			structure::Array1D const& getLMT(unsigned const id) const { return lmt_[id]; }
 			structure::Array1D& getLMT(unsigned const id) { return lmt_[id]; }
 			 MapUnit& getLMU(unsigned id);
 			SaveData& getLSD(unsigned id);
 
+			// map units are evicted least recently used first once their files exceed the budget
+			unsigned lmuBudget() const { return lmuBudget_; }
+			void setLMUBudget(unsigned bytes);
+			// pinned maps aren't evicted even if they exceed the budget
+			void pinLMU(std::set<unsigned> const& ids) { lmuPinned_ = ids; }
+			/*
+			 * returns one map the current map teleports to, or INVALID_ID when all of them were returned.
+			 * the map unit itself isn't loaded, the caller prefetches what it needs from the file.
+			 */
+			unsigned prefetchLMU();
+
 			DataBase& getLDB() { return ldb_; }
 			 MapTree& getLMT() { return lmt_; }
 			 MapUnit& getLMU() { return getLMU( currentMapID() ); }
-			SaveData& getLSD() { return lsd_.front(); }
+			SaveData& getLSD() { return lsd_; }
 
 			int lastLSD() const { return lastSaveDataID_; }
 			double lastLSDStamp() const { return lastSaveDataStamp_; }
@@ -161,6 +209,8 @@ namespace rpg2k
 
 			int currentPageID(unsigned eventID);
 			structure::Array1D const* currentPage(structure::Array2D const& pages) const;
+			// adds events of the current map whose page conditions may have changed since the last call
+			void dirtyPages(std::set<unsigned>& dst);
 
 			RPG2kString const& systemGraphic() const;
 			Wallpaper::Type wallpaperType() const;
@@ -1,5 +1,6 @@
 #include "Debug.hpp"
 #include "SaveData.hpp"
+#include "Stream.hpp"
 #include "Structure.hpp"
 
 #include <algorithm>
@@ -11,24 +12,26 @@ namespace rpg2k
 	namespace model
 	{
 		SaveData::SaveData()
-		: Base( SystemString(), SystemString() ), id_(-1)
+		: Base( SystemString(), SystemString() ), id_(-1), chipReplaceRevision_(0), conditionRevision_(0), synced_(false)
 		{
+			clearConditionChange();
 			Base::reset();
 
 		// reset map chip info
 			resetReplace();
 		}
 		SaveData::SaveData(SystemString const& dir, SystemString const& name)
-		: Base(dir, name), id_(0)
+		: Base(dir, name), id_(0), chipReplaceRevision_(0), conditionRevision_(0), synced_(false)
 		{
+			clearConditionChange();
 			load();
 		}
 		SaveData::SaveData(SystemString const& dir, unsigned const id)
-		: Base(dir, ""), id_(id)
+		: Base(dir, ""), id_(id), chipReplaceRevision_(0), conditionRevision_(0), synced_(false)
 		{
-			std::ostringstream ss;
-			ss << "Save" << std::setfill('0') << std::setw(2) << id << ".lsd";
-			setFileName( ss.str() );
+			clearConditionChange();
+
+			setFileName( slotName(id) );
 
 			checkExists();
 
@@ -43,9 +46,17 @@ namespace rpg2k
 		#endif
 		}
 
+		SystemString SaveData::slotName(unsigned const id)
+		{
+			std::ostringstream ss;
+			ss << "Save" << std::setfill('0') << std::setw(2) << id << ".lsd";
+			return ss.str();
+		}
+
 		SaveData const& SaveData::operator =(SaveData const& src)
 		{
-			this->data() = src.data();
+			this->share(src);
+			this->synced_ = src.synced_;
 
 			this->item_ = src.item_;
 
@@ -55,6 +66,9 @@ namespace rpg2k
 			this->member_ = src.member_;
 
 			this->chipReplace_ = src.chipReplace_;
+			this->chipReplaceRevision_++;
+			this->conditionRevision_++;
+			this->conditionChange_.all = true;
 
 			return *this;
 		}
@@ -92,10 +106,18 @@ namespace rpg2k
 			for(unsigned i = 0; i < ChipSet::END; i++) {
 				chipReplace_[i] = event[21+i].toBinary();
 			}
+			chipReplaceRevision_++;
+
+			conditionRevision_++;
+			conditionChange_.all = true;
+
+			synced_ = true;
 		}
 
 		void SaveData::saveImpl()
 		{
+			if(synced_) return;
+
 			structure::Array1D& status = (*this)[109];
 			structure::Array1D& sys = (*this)[101];
 
@@ -132,6 +154,8 @@ namespace rpg2k
 			for(unsigned i = ChipSet::BEGIN; i < ChipSet::END; i++) {
 				(*this)[111].toArray1D()[21+i] = Binary(chipReplace_[i]);
 			}
+
+			synced_ = true;
 		}
 
 		bool SaveData::addMember(unsigned const charID)
@@ -140,6 +164,9 @@ namespace rpg2k
 			|| std::find( member_.begin(), member_.end(), charID ) == member_.end() ) return false;
 			else {
 				member_.push_back(charID);
+				synced_ = false;
+				conditionRevision_++;
+				conditionChange_.member = true;
 				return true;
 			}
 		}
@@ -148,6 +175,9 @@ namespace rpg2k
 			std::vector<uint16_t>::iterator it = std::find( member_.begin(), member_.end(), charID );
 			if( it != member_.end() ) {
 				member_.erase(it);
+				synced_ = false;
+				conditionRevision_++;
+				conditionChange_.member = true;
 				return true;
 			} else return false;
 		}
@@ -160,6 +190,9 @@ namespace rpg2k
 		{
 			if( id >= switch_.size() ) switch_.resize(id, SWITCH_DEF_VAL);
 			switch_[id - ID_MIN] = data;
+			synced_ = false;
+			conditionRevision_++;
+			conditionChange_.flag.insert(id);
 		}
 
 		int32_t SaveData::var(unsigned const id) const
@@ -170,6 +203,9 @@ namespace rpg2k
 		{
 			if( id >= variable_.size() ) variable_.resize(id, VAR_DEF_VAL);
 			variable_[id - ID_MIN] = data;
+			synced_ = false;
+			conditionRevision_++;
+			conditionChange_.var.insert(id);
 		}
 
 		int SaveData::money() const
@@ -183,6 +219,16 @@ namespace rpg2k
 			else (*this)[109].toArray1D()[21] = data;
 		}
 
+		std::vector<uint32_t> SaveData::randomState() const
+		{
+			structure::Array1D const& sys = system();
+			return sys.exists(201) ? sys[201].toBinary().convert<uint32_t>() : std::vector<uint32_t>();
+		}
+		void SaveData::setRandomState(std::vector<uint32_t> const& state)
+		{
+			system()[201] = Binary(state);
+		}
+
 		unsigned SaveData::itemNum(unsigned const id) const
 		{
 			ItemTable::const_iterator it = item_.find(id);
@@ -200,6 +246,9 @@ namespace rpg2k
 			} else item_[id].num = validVal;
 
 			if( validVal == 0 ) item_.erase(id);
+			synced_ = false;
+			conditionRevision_++;
+			conditionChange_.item.insert(id);
 		}
 
 		unsigned SaveData::itemUse(unsigned const id) const
@@ -211,6 +260,16 @@ namespace rpg2k
 		{
 			ItemTable::iterator it = item_.find(id);
 			if( it != item_.end() ) it->second.use = val;
+			synced_ = false;
+		}
+
+		void SaveData::clearConditionChange()
+		{
+			conditionChange_.flag.clear();
+			conditionChange_.var.clear();
+			conditionChange_.item.clear();
+			conditionChange_.member = false;
+			conditionChange_.all = false;
 		}
 
 		unsigned SaveData::member(unsigned const index) const
@@ -240,6 +299,8 @@ namespace rpg2k
 			unsigned dstVal = chipReplace_[type][dstNo];
 			chipReplace_[type][dstNo] = srcVal;
 			chipReplace_[type][srcNo] = dstVal;
+			chipReplaceRevision_++;
+			synced_ = false;
 		}
 		void SaveData::resetReplace()
 		{
@@ -249,6 +310,37 @@ namespace rpg2k
 				chipReplace_[i].resize(CHIP_REPLACE_MAX);
 				for(unsigned j = 0; j < CHIP_REPLACE_MAX; j++) chipReplace_[i][j] = j;
 			}
+			chipReplaceRevision_++;
+			synced_ = false;
+		}
+
+		SaveDataPreview::SaveDataPreview(SystemString const& dir, unsigned const id)
+		{
+			SystemString const path = SystemString(dir).append(PATH_SEPR).append( SaveData::slotName(id) );
+			if( !fileExists(path) ) return;
+
+			structure::StreamReader s(path);
+			if( !s.checkHeader("LcfSaveData") ) return;
+
+			// skip every top level entry but the preview
+			unsigned const PREVIEW = 100;
+			while( !s.eof() ) {
+				unsigned const index = s.ber();
+				if(index == PREVIEW) {
+					structure::Descriptor const& info =
+						*DefineLoader::instance().arrayDefine("LcfSaveData").find(PREVIEW)->second;
+					Binary bin;
+					data_.reset( new structure::Element( info, s.get(bin) ) );
+					return;
+				}
+				s.seekFromCur( s.ber() );
+			}
+		}
+
+		structure::Element const& SaveDataPreview::operator [](unsigned const index) const
+		{
+			rpg2k_assert( exists() );
+			return data_->toArray1D()[index];
 		}
 	} // namespace model
 } // namespace rpg2k
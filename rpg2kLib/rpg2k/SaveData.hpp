@@ -13,6 +13,12 @@ namespace rpg2k
 		public:
 			struct Item { uint8_t num; uint8_t use; };
 			typedef std::map<uint16_t, Item> ItemTable;
+			// IDs modified since the last clearConditionChange()
+			struct ConditionChange
+			{
+				std::set<unsigned> flag, var, item;
+				bool member, all;
+			};
 		private:
 			unsigned id_;
 
@@ -24,9 +30,16 @@ namespace rpg2k
 			std::vector<uint16_t> member_;
 
 			std::vector< std::vector<uint8_t> > chipReplace_;
+			unsigned chipReplaceRevision_;
+
+			unsigned conditionRevision_;
+			ConditionChange conditionChange_;
 
 			unsigned currentEventID_;
 
+			// whether the element tree holds the current items, switches, variables, members and chip replace
+			bool synced_;
+
 			virtual void loadImpl();
 			virtual void saveImpl();
 
@@ -38,14 +51,21 @@ namespace rpg2k
 			SaveData(SystemString const& dir, unsigned d);
 			virtual ~SaveData();
 
+			// file name of save slot id ( "SaveNN.lsd" )
+			static SystemString slotName(unsigned id);
+
+			// shares the element tree with src until either of them is modified
 			SaveData const& operator =(SaveData const& src);
 
+			// writes items, switches, variables, members and chip replace to the element tree
+			void sync() { saveImpl(); }
+
 			using Base::operator [];
 
 			unsigned id() const { return id_; }
 
 			std::vector<uint16_t> const& member() const { return member_; }
-			std::vector<uint16_t>& member() { return member_; }
+			std::vector<uint16_t>& member() { synced_ = false; return member_; }
 			unsigned member(unsigned index) const;
 			unsigned memberNum() const { return member_.size(); }
 			bool addMember(unsigned charID);
@@ -53,7 +73,7 @@ namespace rpg2k
 
 		// items
 			ItemTable const& item() const { return item_; }
-			ItemTable& item() { return item_; }
+			ItemTable& item() { synced_ = false; return item_; }
 			unsigned itemNum(unsigned id) const;
 			void setItemNum(unsigned id, unsigned val);
 			void addItemNum(unsigned const id, int const val) { setItemNum( id, int(itemNum(id)) + val ); }
@@ -65,15 +85,26 @@ namespace rpg2k
 			int32_t var(unsigned chipID) const;
 			void    setVar(unsigned chipID, int32_t data);
 
+			// incremented every time switches, variables, items or members are modified
+			unsigned conditionRevision() const { return conditionRevision_; }
+			ConditionChange const& conditionChange() const { return conditionChange_; }
+			void clearConditionChange();
+
 			int money() const;
 			void setMoney(int data);
 			void addMoney(int val) { setMoney( money() + val ); }
 
 			unsigned timerLeft() const { return 0; } // TODO
 
+			// random number generator state saved with the game, empty if the file doesn't have one
+			std::vector<uint32_t> randomState() const;
+			void setRandomState(std::vector<uint32_t> const& state);
+
 			unsigned replace(ChipSet::Type const type, unsigned const num) const { return chipReplace_[type][num]; }
 			void replace(ChipSet::Type type, unsigned dstNum, unsigned srcNum);
 			void resetReplace();
+			// incremented every time the chip replace table is modified
+			unsigned replaceRevision() const { return chipReplaceRevision_; }
 
 			structure::Array1D& system() { return (*this)[101]; }
 			structure::Array1D const& system() const { return (*this)[101]; }
@@ -100,6 +131,24 @@ namespace rpg2k
 			structure::Array2D const& eventState() const { return (*this)[111].toArray1D()[11]; }
 			structure::EventState& eventState(unsigned id);
 		};
+
+		// preview ( [100] ) of a save slot, read without parsing the rest of the file
+		class SaveDataPreview
+		{
+		private:
+			std::auto_ptr<structure::Element> data_;
+
+			SaveDataPreview(SaveDataPreview const&);
+			SaveDataPreview const& operator =(SaveDataPreview const&);
+		public:
+			SaveDataPreview(SystemString const& dir, unsigned id);
+
+			bool exists() const { return data_.get() != NULL; }
+
+			structure::Element const& operator [](unsigned index) const;
+
+			double timeStamp() const { return exists() ? (*this)[1].to<double>() : 0.0; }
+		};
 	} // namespace model
 } // namespace rpg2k
 
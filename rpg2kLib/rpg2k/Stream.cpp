@@ -1,6 +1,13 @@
 #include "Debug.hpp"
 #include "Stream.hpp"
 
+#if RPG2K_USE_MMAP
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
 
 namespace rpg2k
 {
@@ -13,14 +20,16 @@ namespace rpg2k
 		StreamReader::StreamReader(std::auto_ptr<StreamInterface> imp)
 		: implement_(imp)
 		{
+			attach();
 		}
 		StreamWriter::StreamWriter(SystemString const& name)
 		: implement_( new FileWriter(name) )
 		{
 		}
 		StreamReader::StreamReader(SystemString const& name)
-		: implement_( new FileReader(name) )
+		: implement_( new MappedFileReader(name) )
 		{
+			attach();
 		}
 		StreamWriter::StreamWriter(Binary& bin)
 		: implement_( new BinaryWriter(bin) )
@@ -29,9 +38,16 @@ namespace rpg2k
 		StreamReader::StreamReader(Binary const& bin)
 		: implement_( new BinaryReader(bin) )
 		{
+			attach();
+		}
+		void StreamReader::attach()
+		{
+			buffer_ = implement_->buffer();
+			bufferSize_ = buffer_? implement_->size() : 0;
+			seek_ = buffer_? implement_->tell() : 0;
 		}
 
-		uint8_t StreamReader::read()
+		uint8_t StreamReader::readFromImplement()
 		{
 			if( eof() ) throw std::runtime_error("is eof");
 			return implement_->read();
@@ -40,13 +56,15 @@ namespace rpg2k
 		{
 			bool res = ( tell()+size ) <= this->size();
 			if( !res ) throw std::runtime_error("reached EOF");
-			return implement_->read(data, size);
+			if(buffer_) {
+				std::memcpy(data, buffer_ + seek_, size);
+				seek_ += size;
+				return size;
+			} else return implement_->read(data, size);
 		}
 		unsigned StreamReader::read(Binary& b)
 		{
-			bool res = ( tell()+b.size() ) <= this->size();
-			if( !res ) throw std::runtime_error("reached EOF");
-			return implement_->read( b.pointer(), b.size() );
+			return b.empty()? 0 : read( b.pointer(), b.size() );
 		}
 
 		void StreamWriter::write(uint8_t data)
@@ -65,13 +83,13 @@ namespace rpg2k
 			return implement_->write( b.pointer(), b.size() );
 		}
 
-		unsigned StreamReader::ber()
+		unsigned StreamReader::berFromImplement()
 		{
 			uint32_t ret = 0;
 			uint8_t data;
 		// extract
 			do {
-				data = this->read();
+				data = this->readFromImplement();
 				ret = (ret << BER_BIT) | (data & BER_MASK);
 			} while(data > BER_SIGN);
 		// result
@@ -138,6 +156,66 @@ namespace rpg2k
 		: FileInterface(name, "rb")
 		{
 		}
+		MappedFileReader::MappedFileReader(SystemString const& name)
+		: name_(name), seek_(0), size_(0), data_(NULL)
+		{
+		#if RPG2K_USE_MMAP
+			int const fd = ::open( name.c_str(), O_RDONLY );
+			rpg2k_assert(fd != -1);
+
+			struct stat st;
+			if( fstat(fd, &st) != 0 ) rpg2k_assert(false);
+			size_ = st.st_size;
+
+			if(size_) {
+				void* const mapped = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+				rpg2k_assert(mapped != MAP_FAILED);
+				data_ = reinterpret_cast<uint8_t const*>(mapped);
+			}
+			::close(fd);
+		#else
+			FILE* fp = std::fopen( name.c_str(), "rb" );
+			rpg2k_assert(fp);
+
+			std::fseek(fp, 0, SEEK_END);
+			buffer_.resize( std::ftell(fp) );
+			std::fseek(fp, 0, SEEK_SET);
+			if( !buffer_.empty() ) {
+				if( std::fread( buffer_.pointer(), sizeof(uint8_t), buffer_.size(), fp ) != buffer_.size() ) rpg2k_assert(false);
+				data_ = buffer_.pointer();
+			}
+			size_ = buffer_.size();
+
+			if( std::fclose(fp) == EOF ) rpg2k_assert(false);
+		#endif
+		}
+		MappedFileReader::~MappedFileReader()
+		{
+		#if RPG2K_USE_MMAP
+			if(data_) munmap( const_cast<uint8_t*>(data_), size_ );
+		#endif
+		}
+		uint8_t MappedFileReader::read()
+		{
+			rpg2k_assert(seek_ < size_);
+			return data_[seek_++];
+		}
+		unsigned MappedFileReader::read(uint8_t* data, unsigned size)
+		{
+			if( (seek_ + size) > size_ ) size = size_ - seek_;
+			std::memcpy(data, data_ + seek_, size);
+			seek_ += size;
+			return size;
+		}
+		// same as fseek() of FileReader but clamped to the file
+		unsigned MappedFileReader::seekFromSet(int val)
+		{
+			seek_ = (val < 0)? 0 : std::min( unsigned(val), size_ );
+			return seek_;
+		}
+		unsigned MappedFileReader::seekFromCur(int val) { return seekFromSet( int(seek_) + val ); }
+		unsigned MappedFileReader::seekFromEnd(int val) { return seekFromSet( int(size_) + val ); }
+
 		FileWriter::FileWriter(SystemString const& name)
 		: FileInterface(name, "w+b")
 		{
@@ -173,7 +251,7 @@ namespace rpg2k
 		: seek_(0), binary_(bin)
 		{
 		}
-		BinaryWriter::BinaryWriter(Binary const& bin)
+		BinaryWriter::BinaryWriter(Binary& bin)
 		: seek_(0), binary_(bin)
 		{
 		}
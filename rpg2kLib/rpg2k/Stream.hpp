@@ -41,6 +41,9 @@ namespace rpg2k
 			virtual unsigned write(uint8_t const* data, unsigned size) { throw std::runtime_error("Unimplemented"); }
 
 			virtual void resize(unsigned size) { throw std::runtime_error("Unimplemented"); }
+
+			// whole stream data if it is in memory, NULL otherwise
+			virtual uint8_t const* buffer() const { return NULL; }
 		};
 
 		class FileInterface : public StreamInterface
@@ -74,6 +77,33 @@ namespace rpg2k
 		public:
 			FileReader(SystemString const& name);
 		};
+		class MappedFileReader : public StreamInterface
+		{
+		private:
+			SystemString name_;
+			unsigned seek_, size_;
+			uint8_t const* data_;
+		#if !RPG2K_USE_MMAP
+			Binary buffer_;
+		#endif
+
+			virtual SystemString const& name() const { return name_; }
+
+			virtual unsigned tell() const { return seek_; }
+			virtual unsigned size() const { return size_; }
+
+			virtual uint8_t read();
+			virtual unsigned read(uint8_t* data, unsigned size);
+
+			virtual unsigned seekFromSet(int val);
+			virtual unsigned seekFromCur(int val);
+			virtual unsigned seekFromEnd(int val);
+
+			virtual uint8_t const* buffer() const { return data_; }
+		public:
+			MappedFileReader(SystemString const& name);
+			virtual ~MappedFileReader();
+		};
 		class FileWriter : public FileInterface
 		{
 		private:
@@ -89,7 +119,7 @@ namespace rpg2k
 		{
 		private:
 			unsigned seek_;
-			Binary binary_;
+			Binary& binary_;
 
 			virtual ~BinaryWriter();
 
@@ -107,7 +137,7 @@ namespace rpg2k
 			unsigned& seekPos() { return seek_; }
 			Binary& binary() { return binary_; }
 		public:
-			BinaryWriter(Binary const& bin);
+			BinaryWriter(Binary& bin);
 			Binary bin() const { return binary_; }
 		};
 		class BinaryReader : public StreamInterface
@@ -118,6 +148,7 @@ namespace rpg2k
 
 			virtual unsigned tell() const { return seek_; }
 			virtual unsigned size() const { return binary_.size(); }
+			virtual uint8_t const* buffer() const { return binary_.empty()? NULL : binary_.pointer(); }
 
 			virtual uint8_t read();
 			virtual unsigned read(uint8_t* data, unsigned size);
@@ -139,6 +170,7 @@ namespace rpg2k
 
 			virtual unsigned tell() const { return seek_; }
 			virtual unsigned size() const { return binary_.size(); }
+			virtual uint8_t const* buffer() const { return binary_.empty()? NULL : binary_.pointer(); }
 
 			virtual uint8_t read();
 			virtual unsigned read(uint8_t* data, unsigned size);
@@ -157,6 +189,18 @@ namespace rpg2k
 		{
 		private:
 			std::auto_ptr<StreamInterface> implement_;
+			/*
+			 * when the data is in memory it's read directly without virtual calls.
+			 * implement_ position is only synchronized at seeking
+			 */
+			uint8_t const* buffer_;
+			unsigned bufferSize_, seek_;
+
+			void attach();
+			unsigned sync(unsigned pos) { seek_ = pos; return pos; }
+
+			uint8_t readFromImplement();
+			unsigned berFromImplement();
 		protected:
 			StreamReader();
 			StreamReader(StreamReader const& s);
@@ -171,20 +215,30 @@ namespace rpg2k
 
 			void close();
 
-			unsigned size() const { return implement_->size(); }
+			unsigned size() const { return buffer_? bufferSize_ : implement_->size(); }
 
 			SystemString const& name() const { return implement_->name(); }
 
-			unsigned seekFromSet(int val = 0) { return implement_->seekFromSet(val); }
-			unsigned seekFromCur(int val = 0) { return implement_->seekFromCur(val); }
-			unsigned seekFromEnd(int val = 0) { return implement_->seekFromEnd(val); }
+			unsigned seekFromSet(int val = 0) { return sync( implement_->seekFromSet(val) ); }
+			unsigned seekFromCur(int val = 0)
+			{
+				if(buffer_) implement_->seekFromSet(seek_);
+				return sync( implement_->seekFromCur(val) );
+			}
+			unsigned seekFromEnd(int val = 0) { return sync( implement_->seekFromEnd(val) ); }
 			unsigned seek(unsigned pos = 0) { return seekFromSet(pos); }
 
-			unsigned tell() const { return implement_->tell(); }
+			unsigned tell() const { return buffer_? seek_ : implement_->tell(); }
 
 			bool eof() const { return tell() >= size(); }
 
-			uint8_t read();
+			uint8_t read()
+			{
+				if(!buffer_) return readFromImplement();
+
+				if(seek_ >= bufferSize_) throw std::runtime_error("is eof");
+				return buffer_[seek_++];
+			}
 			unsigned read(uint8_t* data, unsigned size);
 		/*
 		 * read and copy to argument
@@ -192,7 +246,19 @@ namespace rpg2k
 		 */
 			unsigned read(Binary& b);
 
-			unsigned ber();
+			unsigned ber()
+			{
+				if(!buffer_) return berFromImplement();
+
+				uint32_t ret = 0;
+				uint8_t data;
+				do {
+					if(seek_ >= bufferSize_) throw std::runtime_error("is eof");
+					data = buffer_[seek_++];
+					ret = (ret << BER_BIT) | (data & BER_MASK);
+				} while(data > BER_SIGN);
+				return ret;
+			}
 
 			Binary& get(Binary& b) { b.resize( ber() ); read(b); return b; }
 
@@ -1,14 +1,53 @@
+#ifndef _INC__RPG2K__DEFINE__DEFINE_HPP
+#define _INC__RPG2K__DEFINE__DEFINE_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
 
 namespace rpg2k
 {
 	namespace define
 	{
-		extern const char* EventState;
-		extern const char* LcfDataBase;
-		extern const char* LcfMapTree;
-		extern const char* LcfMapUnit;
-		extern const char* LcfSaveData;
-		extern const char* Music;
-		extern const char* Sound;
-	}
-}
+		/*
+		 * static schema of lcf elements
+		 * index is 0 at top level
+		 * defaultValue is the name of referenced define when type is an array
+		 * member is NULL unless the field has inline array block
+		 */
+		struct Field
+		{
+			unsigned index;
+			char const* type;
+			char const* name;
+			char const* defaultValue;
+			Field const* member;
+			unsigned memberNum;
+		};
+		struct Schema
+		{
+			Field const* field;
+			unsigned fieldNum;
+		};
+
+		#define PP_member(table) table, ( sizeof(table) / sizeof(table[0]) )
+		#define PP_noMember NULL, 0
+
+		extern Schema const EventState;
+		extern Schema const LcfDataBase;
+		extern Schema const LcfMapTree;
+		extern Schema const LcfMapUnit;
+		extern Schema const LcfSaveData;
+		extern Schema const Music;
+		extern Schema const Sound;
+
+		/*
+		 * unicode of CP932 double byte characters, 0 if unmapped
+		 * rows are the lead bytes 0x81-0x9f and 0xe0-0xfc, columns the trail bytes 0x40-0xfc
+		 */
+		enum { CP932_LEAD_NUM = 60, CP932_TRAIL_BEGIN = 0x40, CP932_TRAIL_NUM = 0xfd - 0x40, };
+		extern uint16_t const CP932[CP932_LEAD_NUM * CP932_TRAIL_NUM];
+	} // namespace define
+} // namespace rpg2k
+
+#endif // _INC__RPG2K__DEFINE__DEFINE_HPP
@@ -1,61 +1,75 @@
 #include "Define.hpp"
 
-const char* rpg2k::define::EventState = (" \
-Array1D EventState \n \
-{ \n \
-	[11]: int mapID; \n \
-	[12]: int x = 0; \n \
-	[13]: int y = 0; \n \
- \n \
-	[21]: int defDir; \n \
-	[22]: int talkDir; \n \
-	[23]: int dummy; \n \
-	[24]: int dummy; \n \
- \n \
-	[31]: int action = 0; \n \
-	[32]: int freq; \n \
-	[33]: int startType = 0; \n \
-	[34]: int priorityType; \n \
-	[35]: int dummy; \n \
-	[36]: int animeType = 0; \n \
-	[37]: int speed = 3; \n \
- \n \
-	[41]: Array1D Move \n \
-	{ \n \
-		[11]: int length = 0; \n \
-		[12]: Binary data; \n \
-\n \
-		[21]: bool repeat = true; \n \
-		[22]: bool pass = false; \n \
-	}; \n \
-	[43]: int dummy; \n \
-	[46]: bool isTrans = false; \n \
- \n \
-	// [51]: \n \
-	[52]: int counter = 0; \n \
-	[53]: int dummy; \n \
-	[54]: int dummy; \n \
- \n \
-	[71]: int dummy; \n \
-	[72]: int dummy; \n \
-	[73]: string charSet; \n \
-	[74]: int charSetPos = 0; \n \
-	[75]: int charSetPat = 1; \n \
-\n \
-	[81]: int dummy; \n \
-	[82]: int dummy; \n \
-	[83]: int dummy; \n \
-\n \
-	[101]: int dummy; \n \
-	[103]: int vehicle = 0; \n \
-	[108]: Array1D dummy \n \
-	{ \n \
-		[1]: int dummy; \n \
-	}; \n \
- \n \
-	[121]: int dummy; \n \
- \n \
-	[131]: int dummy; \n \
-	[132]: Binary dummy; \n \
-}; \n \
-");
+namespace
+{
+	using rpg2k::define::Field;
+
+	Field const EventState_EventState_Move[] =
+	{
+		{ 11, "int", "length", "0", PP_noMember },
+		{ 12, "Binary", "data", NULL, PP_noMember },
+
+		{ 21, "bool", "repeat", "true", PP_noMember },
+		{ 22, "bool", "pass", "false", PP_noMember },
+	};
+
+	Field const EventState_EventState_dummy[] =
+	{
+		{ 1, "int", "dummy", NULL, PP_noMember },
+	};
+
+	Field const EventState_EventState[] =
+	{
+		{ 11, "int", "mapID", NULL, PP_noMember },
+		{ 12, "int", "x", "0", PP_noMember },
+		{ 13, "int", "y", "0", PP_noMember },
+
+		{ 21, "int", "defDir", NULL, PP_noMember },
+		{ 22, "int", "talkDir", NULL, PP_noMember },
+		{ 23, "int", "dummy", NULL, PP_noMember },
+		{ 24, "int", "dummy", NULL, PP_noMember },
+
+		{ 31, "int", "action", "0", PP_noMember },
+		{ 32, "int", "freq", NULL, PP_noMember },
+		{ 33, "int", "startType", "0", PP_noMember },
+		{ 34, "int", "priorityType", NULL, PP_noMember },
+		{ 35, "int", "dummy", NULL, PP_noMember },
+		{ 36, "int", "animeType", "0", PP_noMember },
+		{ 37, "int", "speed", "3", PP_noMember },
+
+		{ 41, "Array1D", "Move", NULL, PP_member(EventState_EventState_Move) },
+		{ 43, "int", "dummy", NULL, PP_noMember },
+		{ 46, "bool", "isTrans", "false", PP_noMember },
+
+		// [51]:
+		{ 52, "int", "counter", "0", PP_noMember },
+		{ 53, "int", "dummy", NULL, PP_noMember },
+		{ 54, "int", "dummy", NULL, PP_noMember },
+
+		{ 71, "int", "dummy", NULL, PP_noMember },
+		{ 72, "int", "dummy", NULL, PP_noMember },
+		{ 73, "string", "charSet", NULL, PP_noMember },
+		{ 74, "int", "charSetPos", "0", PP_noMember },
+		{ 75, "int", "charSetPat", "1", PP_noMember },
+
+		{ 81, "int", "dummy", NULL, PP_noMember },
+		{ 82, "int", "dummy", NULL, PP_noMember },
+		{ 83, "int", "dummy", NULL, PP_noMember },
+
+		{ 101, "int", "dummy", NULL, PP_noMember },
+		{ 103, "int", "vehicle", "0", PP_noMember },
+		{ 108, "Array1D", "dummy", NULL, PP_member(EventState_EventState_dummy) },
+
+		{ 121, "int", "dummy", NULL, PP_noMember },
+
+		{ 131, "int", "dummy", NULL, PP_noMember },
+		{ 132, "Binary", "dummy", NULL, PP_noMember },
+	};
+
+	Field const top[] =
+	{
+		{ 0, "Array1D", "EventState", NULL, PP_member(EventState_EventState) },
+	};
+} // namespace
+
+rpg2k::define::Schema const rpg2k::define::EventState = { PP_member(top) };
@@ -1,54 +1,68 @@
 #include "Define.hpp"
 
-const char* rpg2k::define::LcfMapTree = (" \
-Array2D Grobal \n \
-{ \n \
-	[1]: string name = \"\"; \n \
-	[2]: int parentMapID; \n \
- \n \
-	[3]: int type; \n \
-	[4]: int type; // copy of [3] ? \n \
-	[5]: int unknown0; \n \
-	[6]: int unknown1; \n \
-	[7]: bool isOpen = false; // relate with nest? \n \
- \n \
-	[11]: int musicType; \n \
-	[12]: Music music; \n \
- \n \
-	[21]: int backdropType; \n \
-	[22]: string backdrop; \n \
- \n \
-	[31]: int teleport; \n \
-	[32]: int escape; \n \
-	[33]: int save; \n \
- \n \
-	[41]: Array2D Encount \n \
-	{ \n \
-		[1]: int enemyGroupID; \n \
-	}; \n \
-	[44]: int encuntStep = 25; \n \
- \n \
-	[51]: Binary areaRange; // uint32_t[4] = { startx, starty, endx, endy }; \n \
-}; \n \
- \n \
-BerEnum mapExist; \n \
- \n \
-Array1D StartPoint \n \
-{ \n \
-	[1]: int partyMapID; \n \
-	[2]: int partyX = 0; \n \
-	[3]: int partyY = 0; \n \
- \n \
-	[11]: int boatMapID = 0; \n \
-	[12]: int boatX = 0; \n \
-	[13]: int boatY = 0; \n \
- \n \
-	[21]: int shipMapID = 0; \n \
-	[22]: int shipX = 0; \n \
-	[23]: int shipY = 0; \n \
- \n \
-	[31]: int airshipMapID = 0; \n \
-	[32]: int airshipX = 0; \n \
-	[33]: int airshipY = 0; \n \
-}; \n \
-");
+namespace
+{
+	using rpg2k::define::Field;
+
+	Field const LcfMapTree_Grobal_Encount[] =
+	{
+		{ 1, "int", "enemyGroupID", NULL, PP_noMember },
+	};
+
+	Field const LcfMapTree_Grobal[] =
+	{
+		{ 1, "string", "name", "\"\"", PP_noMember },
+		{ 2, "int", "parentMapID", NULL, PP_noMember },
+
+		{ 3, "int", "type", NULL, PP_noMember },
+		{ 4, "int", "type", NULL, PP_noMember }, // copy of [3] ?
+		{ 5, "int", "unknown0", NULL, PP_noMember },
+		{ 6, "int", "unknown1", NULL, PP_noMember },
+		{ 7, "bool", "isOpen", "false", PP_noMember }, // relate with nest?
+
+		{ 11, "int", "musicType", NULL, PP_noMember },
+		{ 12, "Music", "music", NULL, PP_noMember },
+
+		{ 21, "int", "backdropType", NULL, PP_noMember },
+		{ 22, "string", "backdrop", NULL, PP_noMember },
+
+		{ 31, "int", "teleport", NULL, PP_noMember },
+		{ 32, "int", "escape", NULL, PP_noMember },
+		{ 33, "int", "save", NULL, PP_noMember },
+
+		{ 41, "Array2D", "Encount", NULL, PP_member(LcfMapTree_Grobal_Encount) },
+		{ 44, "int", "encuntStep", "25", PP_noMember },
+
+		{ 51, "Binary", "areaRange", NULL, PP_noMember }, // uint32_t[4] = { startx, starty, endx, endy };
+	};
+
+	Field const LcfMapTree_StartPoint[] =
+	{
+		{ 1, "int", "partyMapID", NULL, PP_noMember },
+		{ 2, "int", "partyX", "0", PP_noMember },
+		{ 3, "int", "partyY", "0", PP_noMember },
+
+		{ 11, "int", "boatMapID", "0", PP_noMember },
+		{ 12, "int", "boatX", "0", PP_noMember },
+		{ 13, "int", "boatY", "0", PP_noMember },
+
+		{ 21, "int", "shipMapID", "0", PP_noMember },
+		{ 22, "int", "shipX", "0", PP_noMember },
+		{ 23, "int", "shipY", "0", PP_noMember },
+
+		{ 31, "int", "airshipMapID", "0", PP_noMember },
+		{ 32, "int", "airshipX", "0", PP_noMember },
+		{ 33, "int", "airshipY", "0", PP_noMember },
+	};
+
+	Field const top[] =
+	{
+		{ 0, "Array2D", "Grobal", NULL, PP_member(LcfMapTree_Grobal) },
+
+		{ 0, "BerEnum", "mapExist", NULL, PP_noMember },
+
+		{ 0, "Array1D", "StartPoint", NULL, PP_member(LcfMapTree_StartPoint) },
+	};
+} // namespace
+
+rpg2k::define::Schema const rpg2k::define::LcfMapTree = { PP_member(top) };
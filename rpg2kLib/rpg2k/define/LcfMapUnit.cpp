@@ -1,74 +1,92 @@
 #include "Define.hpp"
 
-const char* rpg2k::define::LcfMapUnit = (" \
-Array1D Grobal \n \
-{ \n \
-	[1]: int chipSetID = 1; \n \
-	[2]: int width     = 20; \n \
-	[3]: int height    = 15; \n \
- \n \
-	[11]: int scrollType; \n \
- \n \
-	[31]: bool usePanorama = false; \n \
-	[32]: string panorama; \n \
-	[33]: bool scrollPanoramaH = false; \n \
-	[34]: bool scrollPanoramaV = false; \n \
-	[35]: bool autoScrollPanoramaH = false; \n \
-	[36]: int autoScrollPanoramaSpeedH = 0; \n \
-	[37]: bool autoScrollPanoramaV = false; \n \
-	[38]: int autoScrollPanoramaSpeedV = 0; \n \
- \n \
-	[71]: Binary lower; \n \
-	[72]: Binary upper; \n \
- \n \
-	[81]: Array2D Event \n \
-	{ \n \
-		[1]: string name; \n \
-		[2]: int x = 0; \n \
-		[3]: int y = 0; \n \
-		// [4]: \n \
-		[5]: Array2D Page \n \
-		{ \n \
-			[2]: Array1D Term \n \
-			{ \n \
-				[1]: int flag = 0; \n \
-				[2]: int switchID1 = 1; \n \
-				[3]: int switchID2 = 1; \n \
-				[4]: int variableID = 1; \n \
-				[5]: int value = 0; \n \
-				[6]: int itemID = 1; \n \
-				[7]: int charID = 1; \n \
-				[8]: int timerLeft = 0; \n \
-			}; \n \
- \n \
-			[21]: string charSet; \n \
-			[22]: int charSetPos = 0; \n \
-			[23]: int charSetdir = 2; \n \
-			[24]: int charSetPat = 1; \n \
-			[25]: bool semiTrans = false; \n \
- \n \
-			[31]: int action = 0; \n \
-			[32]: int freq = 3; \n \
-			[33]: int startType = 0; \n \
-			[34]: int priorityType = 0; \n \
-			[35]: bool noPile = false; \n \
-			[36]: int animeType = 0; \n \
-			[37]: int speed = 3; \n \
- \n \
-			[41]: Array1D Move \n \
-			{ \n \
-				[11]: int length = 0; \n \
-				[12]: Binary data; \n \
- \n \
-				[21]: bool repeat = true; \n \
-				[22]: bool pass = false; \n \
-			}; \n \
- \n \
-			[51]: int eventLength = 0; \n \
-			[52]: Event event; \n \
-		}; \n \
-	}; \n \
- \n \
-	[91]: int saveTime; \n \
-}; \n \
-");
+namespace
+{
+	using rpg2k::define::Field;
+
+	Field const LcfMapUnit_Grobal_Event_Page_Term[] =
+	{
+		{ 1, "int", "flag", "0", PP_noMember },
+		{ 2, "int", "switchID1", "1", PP_noMember },
+		{ 3, "int", "switchID2", "1", PP_noMember },
+		{ 4, "int", "variableID", "1", PP_noMember },
+		{ 5, "int", "value", "0", PP_noMember },
+		{ 6, "int", "itemID", "1", PP_noMember },
+		{ 7, "int", "charID", "1", PP_noMember },
+		{ 8, "int", "timerLeft", "0", PP_noMember },
+	};
+
+	Field const LcfMapUnit_Grobal_Event_Page_Move[] =
+	{
+		{ 11, "int", "length", "0", PP_noMember },
+		{ 12, "Binary", "data", NULL, PP_noMember },
+
+		{ 21, "bool", "repeat", "true", PP_noMember },
+		{ 22, "bool", "pass", "false", PP_noMember },
+	};
+
+	Field const LcfMapUnit_Grobal_Event_Page[] =
+	{
+		{ 2, "Array1D", "Term", NULL, PP_member(LcfMapUnit_Grobal_Event_Page_Term) },
+
+		{ 21, "string", "charSet", NULL, PP_noMember },
+		{ 22, "int", "charSetPos", "0", PP_noMember },
+		{ 23, "int", "charSetdir", "2", PP_noMember },
+		{ 24, "int", "charSetPat", "1", PP_noMember },
+		{ 25, "bool", "semiTrans", "false", PP_noMember },
+
+		{ 31, "int", "action", "0", PP_noMember },
+		{ 32, "int", "freq", "3", PP_noMember },
+		{ 33, "int", "startType", "0", PP_noMember },
+		{ 34, "int", "priorityType", "0", PP_noMember },
+		{ 35, "bool", "noPile", "false", PP_noMember },
+		{ 36, "int", "animeType", "0", PP_noMember },
+		{ 37, "int", "speed", "3", PP_noMember },
+
+		{ 41, "Array1D", "Move", NULL, PP_member(LcfMapUnit_Grobal_Event_Page_Move) },
+
+		{ 51, "int", "eventLength", "0", PP_noMember },
+		{ 52, "Event", "event", NULL, PP_noMember },
+	};
+
+	Field const LcfMapUnit_Grobal_Event[] =
+	{
+		{ 1, "string", "name", NULL, PP_noMember },
+		{ 2, "int", "x", "0", PP_noMember },
+		{ 3, "int", "y", "0", PP_noMember },
+		// [4]:
+		{ 5, "Array2D", "Page", NULL, PP_member(LcfMapUnit_Grobal_Event_Page) },
+	};
+
+	Field const LcfMapUnit_Grobal[] =
+	{
+		{ 1, "int", "chipSetID", "1", PP_noMember },
+		{ 2, "int", "width", "20", PP_noMember },
+		{ 3, "int", "height", "15", PP_noMember },
+
+		{ 11, "int", "scrollType", NULL, PP_noMember },
+
+		{ 31, "bool", "usePanorama", "false", PP_noMember },
+		{ 32, "string", "panorama", NULL, PP_noMember },
+		{ 33, "bool", "scrollPanoramaH", "false", PP_noMember },
+		{ 34, "bool", "scrollPanoramaV", "false", PP_noMember },
+		{ 35, "bool", "autoScrollPanoramaH", "false", PP_noMember },
+		{ 36, "int", "autoScrollPanoramaSpeedH", "0", PP_noMember },
+		{ 37, "bool", "autoScrollPanoramaV", "false", PP_noMember },
+		{ 38, "int", "autoScrollPanoramaSpeedV", "0", PP_noMember },
+
+		{ 71, "Binary", "lower", NULL, PP_noMember },
+		{ 72, "Binary", "upper", NULL, PP_noMember },
+
+		{ 81, "Array2D", "Event", NULL, PP_member(LcfMapUnit_Grobal_Event) },
+
+		{ 91, "int", "saveTime", NULL, PP_noMember },
+	};
+
+	Field const top[] =
+	{
+		{ 0, "Array1D", "Grobal", NULL, PP_member(LcfMapUnit_Grobal) },
+	};
+} // namespace
+
+rpg2k::define::Schema const rpg2k::define::LcfMapUnit = { PP_member(top) };
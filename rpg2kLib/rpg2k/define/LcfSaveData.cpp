@@ -1,274 +1,308 @@
 #include "Define.hpp"
 
-const char* rpg2k::define::LcfSaveData = (" \
-Array1D Grobal \n \
-{ \n \
-	[100]: Array1D Preview \n \
-	{ \n \
-		[1]: double timeStamp; \n \
- \n \
-		[11]: string name; \n \
-		[12]: int level = 1; \n \
-		[13]: int HP; \n \
- \n \
-		[21]: string faceSet1; \n \
-		[22]: int faceSetPos1 = 0; \n \
-		[23]: string faceSet2; \n \
-		[24]: int faceSetPos2 = 0; \n \
-		[25]: string faceSet3; \n \
-		[26]: int faceSetPos3 = 0; \n \
-		[27]: string faceSet4; \n \
-		[28]: int faceSetPos4 = 0; \n \
-	}; \n \
- \n \
-	[101]: Array1D System \n \
-	{ \n \
-		[1]: int dummy; \n \
- \n \
-		[11]: int dummy; \n \
- \n \
-		[21]: string system; \n \
-		[22]: int wallpaper; \n \
-		[23]: int font; \n \
- \n \
-		[31]: int switchDataNum = 0; \n \
-		[32]: Binary switchData; \n \
-		[33]: int variableDataNum = 0; \n \
-		[34]: Binary variableData; \n \
- \n \
-		[41]: int windowType = 0; \n \
-		[42]: int windowViewPoint = 2; \n \
-		[43]: bool doNotHideParty = true; \n \
-		[44]: bool moveWhenWait = false; \n \
- \n \
-		[51]: string faceSet; \n \
-		[52]: int faceSetPos = 0; \n \
-		[53]: int side = 0; \n \
-		[54]: bool flip = false; \n \
-		[55]: bool partyTransparent = false; \n \
- \n \
-		[71]: Music dummy; \n \
-		[72]: Music battle; \n \
-		[73]: Music battleEnd; \n \
-		[74]: Music hotel; \n \
-		[75]: Music current; \n \
-		[76]: Music dummy; \n \
-		[77]: Music dummy; \n \
-		[78]: Music memorized; \n \
-		[79]: Music boat; \n \
-		[80]: Music ship; \n \
-		[81]: Music airShip; \n \
-		[82]: Music gameOver; \n \
- \n \
-		[ 91]: Sound cursorMove; \n \
-		[ 92]: Sound enter; \n \
-		[ 93]: Sound cancel; \n \
-		[ 94]: Sound buzzer; \n \
-		[ 95]: Sound battleStart; \n \
-		[ 96]: Sound runAway; \n \
-		[ 97]: Sound enemyAttack; \n \
-		[ 98]: Sound enemyDamaged; \n \
-		[ 99]: Sound partyDamaged; \n \
-		[100]: Sound evasion; \n \
-		[101]: Sound enamyDead; \n \
-		[102]: Sound itemUse; \n \
- \n \
-		[111]: Binary moveErase; \n \
-		[112]: Binary moveShow; \n \
-		[113]: Binary battleStartErase; \n \
-		[114]: Binary battleStartShow; \n \
-		[115]: Binary battleEndErase; \n \
-		[116]: Binary battleEndShow; \n \
- \n \
-		[121]: bool canTeleport; \n \
-		[122]: bool canEscape; \n \
-		[123]: bool canSave; \n \
-		[124]: bool canOpenMenu; \n \
-		[125]: string backdrop; \n \
- \n \
-		[131]: int saveTime; \n \
-	}; \n \
- \n \
-	[102]: Array1D dummy \n \
-	{ \n \
-		[1]: Binary dummy; \n \
- \n \
-		[11]: Binary dummy; \n \
- \n \
-		[31]: Binary dummy; \n \
-		[32]: Binary dummy; \n \
- \n \
-		[41]: Binary dummy; \n \
-		[42]: Binary dummy; \n \
-		[43]: Binary dummy; \n \
-		[44]: Binary dummy; \n \
-		[45]: Binary dummy; \n \
- \n \
-		[49]: Binary dummy; \n \
-	}; \n \
- \n \
-	[103]: Array2D Picture \n \
-	{ \n \
-		[1]: string picture; \n \
-		[2]: double startX = 160; \n \
-		[3]: double startY = 120; \n \
-		[4]: double currentX = 160; \n \
-		[5]: double currentY = 120; \n \
-		[6]: bool scroll = false; \n \
-		[8]: double dummy; \n \
-		[9]: bool trans = false; \n \
- \n \
-		[11]: double red; \n \
-		[12]: double green; \n \
-		[13]: double blue; \n \
-		[14]: double chroma; \n \
-		[15]: int effect; \n \
-		[16]: double speedOrPower; \n \
- \n \
-		[31]: double goalX; \n \
-		[32]: double goalY; \n \
-		[33]: int magnify = 100; \n \
-		[34]: int trans = 0; \n \
- \n \
-		[41]: int red   = 100; \n \
-		[42]: int green = 100; \n \
-		[43]: int blue  = 100; \n \
-		[44]: int chroma = 100; \n \
-		[46]: int speedOrPower; \n \
- \n \
-		[51]: int countDown = 0; \n \
-		[52]: double degree; \n \
-		[53]: int dummy; \n \
-	}; \n \
- \n \
-	[104]: EventState Party  ; \n \
-	[105]: EventState Boat   ; \n \
-	[106]: EventState Ship   ; \n \
-	[107]: EventState Airship; \n \
- \n \
-	[108]: Array2D Character \n \
-	{ \n \
-		[1]: string name; \n \
-		[2]: string title; \n \
-		[3]: bool semiTrans; \n \
- \n \
-		[11]: string charSet; \n \
-		[12]: int charSetPos; \n \
-		[13]: bool trans; \n \
- \n \
-		[21]: string faceSet; \n \
-		[22]: int faceSetPos; \n \
- \n \
-		[31]: int level; \n \
-		[32]: int exp; \n \
-		[33]: int HP; \n \
-		[34]: int MP; \n \
- \n \
-		[41]: int attack = 0; \n \
-		[42]: int gaurd  = 0; \n \
-		[43]: int mind   = 0; \n \
-		[44]: int speed  = 0; \n \
- \n \
-		[51]: int skillDataNum = 0; \n \
-		[52]: Binary skillData; // std::set<uint16_t> \n \
- \n \
-		[61]: Binary equipment; // std::array<uint16_t, 5> \n \
- \n \
-		[71]: int curHP = 0; \n \
-		[72]: int curMP = 0; \n \
- \n \
-		[81]: int conditionStepNum = 0; \n \
-		[82]: Binary conditionStep; // std::vector<uint16_t> \n \
-		[83]: int conditionNum = 0; \n \
-		[84]: Binary condition; // std::vector<uint8_t> \n \
- \n \
-		[90]: int job; \n \
-		[91]: bool doubleHand; \n \
-	}; \n \
- \n \
-	[109]: Array1D Status \n \
-	{ \n \
-		[1]: int memberNum = 0; \n \
-		[2]: Binary member; \n \
- \n \
-		[11]: int itemTypeNum = 0; \n \
-		[12]: Binary itemID; \n \
-		[13]: Binary itemNum; \n \
-		[14]: Binary ItemUse; \n \
- \n \
-		[21]: int money = 0; \n \
-		// [23]: \n \
- \n \
-		[32]: int battle = 0; \n \
-		[33]: int loss = 0; \n \
-		[34]: int win = 0; \n \
-		[35]: int escape = 0; \n \
- \n \
-		[41]: int dummy; \n \
-		[42]: Binary dummy; \n \
-	}; \n \
- \n \
-	[110]: Array2D Teleport \n \
-	{ \n \
-		[1]: int mapID = 0; \n \
-		[2]: int x = 0; \n \
-		[3]: int y = 0; \n \
-		[4]: bool onAfterTeleport = false; \n \
-		[5]: int switchID = 1; \n \
-	}; \n \
- \n \
-	[111]: Array1D EventData \n \
-	{ \n \
-		[1]: int dummy; \n \
-		[3]: int encountRate; \n \
- \n \
-		[5]: int chipSetID; \n \
- \n \
-		[11]: Array2D info = EventState; \n \
- \n \
-		[21]: Binary replaceLower; \n \
-		[22]: Binary replaceUpper; \n \
- \n \
-		[31]: bool usePanorama; \n \
-		[32]: string panorama; \n \
-		[33]: bool horizontalScroll; \n \
-		[34]: bool verticalScroll; \n \
-		[35]: bool horizontalScrollAuto; \n \
-		[36]: int horizontalScrollSpeed; \n \
-		[37]: bool verticalScrollAuto; \n \
-		[38]: int verticalScrollSpeed; \n \
-	}; \n \
- \n \
-	[112]: Array1D dummy \n \
-	{ \n \
-	}; \n \
- \n \
-	[113]: Array1D dummy \n \
-	{ \n \
-		[1]: Array2D dummy \n \
-		{ \n \
-			[1]: int eventLength; \n \
-			[2]: Event dummy; \n \
- \n \
-			[11]: int dummy; \n \
-			[12]: int dummy; \n \
-			[13]: Event dummy; \n \
- \n \
-			[21]: int dummy; \n \
-			[22]: int dummy; \n \
- \n \
-			// [31]: \n \
-		}; \n \
-		[4]: int dummy; \n \
-	}; \n \
- \n \
-	[114]: Array2D dummy \n \
-	{ \n \
-		[1]: Array1D dummy \n \
-		{ \n \
-			[1]: Binary dummy; \n \
-		}; \n \
-	}; \n \
- \n \
-}; \n \
-");
+namespace
+{
+	using rpg2k::define::Field;
+
+	Field const LcfSaveData_Grobal_Preview[] =
+	{
+		{ 1, "double", "timeStamp", NULL, PP_noMember },
+
+		{ 11, "string", "name", NULL, PP_noMember },
+		{ 12, "int", "level", "1", PP_noMember },
+		{ 13, "int", "HP", NULL, PP_noMember },
+
+		{ 21, "string", "faceSet1", NULL, PP_noMember },
+		{ 22, "int", "faceSetPos1", "0", PP_noMember },
+		{ 23, "string", "faceSet2", NULL, PP_noMember },
+		{ 24, "int", "faceSetPos2", "0", PP_noMember },
+		{ 25, "string", "faceSet3", NULL, PP_noMember },
+		{ 26, "int", "faceSetPos3", "0", PP_noMember },
+		{ 27, "string", "faceSet4", NULL, PP_noMember },
+		{ 28, "int", "faceSetPos4", "0", PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_System[] =
+	{
+		{ 1, "int", "dummy", NULL, PP_noMember },
+
+		{ 11, "int", "dummy", NULL, PP_noMember },
+
+		{ 21, "string", "system", NULL, PP_noMember },
+		{ 22, "int", "wallpaper", NULL, PP_noMember },
+		{ 23, "int", "font", NULL, PP_noMember },
+
+		{ 31, "int", "switchDataNum", "0", PP_noMember },
+		{ 32, "Binary", "switchData", NULL, PP_noMember },
+		{ 33, "int", "variableDataNum", "0", PP_noMember },
+		{ 34, "Binary", "variableData", NULL, PP_noMember },
+
+		{ 41, "int", "windowType", "0", PP_noMember },
+		{ 42, "int", "windowViewPoint", "2", PP_noMember },
+		{ 43, "bool", "doNotHideParty", "true", PP_noMember },
+		{ 44, "bool", "moveWhenWait", "false", PP_noMember },
+
+		{ 51, "string", "faceSet", NULL, PP_noMember },
+		{ 52, "int", "faceSetPos", "0", PP_noMember },
+		{ 53, "int", "side", "0", PP_noMember },
+		{ 54, "bool", "flip", "false", PP_noMember },
+		{ 55, "bool", "partyTransparent", "false", PP_noMember },
+
+		{ 71, "Music", "dummy", NULL, PP_noMember },
+		{ 72, "Music", "battle", NULL, PP_noMember },
+		{ 73, "Music", "battleEnd", NULL, PP_noMember },
+		{ 74, "Music", "hotel", NULL, PP_noMember },
+		{ 75, "Music", "current", NULL, PP_noMember },
+		{ 76, "Music", "dummy", NULL, PP_noMember },
+		{ 77, "Music", "dummy", NULL, PP_noMember },
+		{ 78, "Music", "memorized", NULL, PP_noMember },
+		{ 79, "Music", "boat", NULL, PP_noMember },
+		{ 80, "Music", "ship", NULL, PP_noMember },
+		{ 81, "Music", "airShip", NULL, PP_noMember },
+		{ 82, "Music", "gameOver", NULL, PP_noMember },
+
+		{ 91, "Sound", "cursorMove", NULL, PP_noMember },
+		{ 92, "Sound", "enter", NULL, PP_noMember },
+		{ 93, "Sound", "cancel", NULL, PP_noMember },
+		{ 94, "Sound", "buzzer", NULL, PP_noMember },
+		{ 95, "Sound", "battleStart", NULL, PP_noMember },
+		{ 96, "Sound", "runAway", NULL, PP_noMember },
+		{ 97, "Sound", "enemyAttack", NULL, PP_noMember },
+		{ 98, "Sound", "enemyDamaged", NULL, PP_noMember },
+		{ 99, "Sound", "partyDamaged", NULL, PP_noMember },
+		{ 100, "Sound", "evasion", NULL, PP_noMember },
+		{ 101, "Sound", "enamyDead", NULL, PP_noMember },
+		{ 102, "Sound", "itemUse", NULL, PP_noMember },
+
+		{ 111, "Binary", "moveErase", NULL, PP_noMember },
+		{ 112, "Binary", "moveShow", NULL, PP_noMember },
+		{ 113, "Binary", "battleStartErase", NULL, PP_noMember },
+		{ 114, "Binary", "battleStartShow", NULL, PP_noMember },
+		{ 115, "Binary", "battleEndErase", NULL, PP_noMember },
+		{ 116, "Binary", "battleEndShow", NULL, PP_noMember },
+
+		{ 121, "bool", "canTeleport", NULL, PP_noMember },
+		{ 122, "bool", "canEscape", NULL, PP_noMember },
+		{ 123, "bool", "canSave", NULL, PP_noMember },
+		{ 124, "bool", "canOpenMenu", NULL, PP_noMember },
+		{ 125, "string", "backdrop", NULL, PP_noMember },
+
+		{ 131, "int", "saveTime", NULL, PP_noMember },
+
+		// not in RPG_RT: state of the random number generators
+		{ 201, "Binary", "randomState", NULL, PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_dummy[] =
+	{
+		{ 1, "Binary", "dummy", NULL, PP_noMember },
+
+		{ 11, "Binary", "dummy", NULL, PP_noMember },
+
+		{ 31, "Binary", "dummy", NULL, PP_noMember },
+		{ 32, "Binary", "dummy", NULL, PP_noMember },
+
+		{ 41, "Binary", "dummy", NULL, PP_noMember },
+		{ 42, "Binary", "dummy", NULL, PP_noMember },
+		{ 43, "Binary", "dummy", NULL, PP_noMember },
+		{ 44, "Binary", "dummy", NULL, PP_noMember },
+		{ 45, "Binary", "dummy", NULL, PP_noMember },
+
+		{ 49, "Binary", "dummy", NULL, PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_Picture[] =
+	{
+		{ 1, "string", "picture", NULL, PP_noMember },
+		{ 2, "double", "startX", "160", PP_noMember },
+		{ 3, "double", "startY", "120", PP_noMember },
+		{ 4, "double", "currentX", "160", PP_noMember },
+		{ 5, "double", "currentY", "120", PP_noMember },
+		{ 6, "bool", "scroll", "false", PP_noMember },
+		{ 8, "double", "dummy", NULL, PP_noMember },
+		{ 9, "bool", "trans", "false", PP_noMember },
+
+		{ 11, "double", "red", NULL, PP_noMember },
+		{ 12, "double", "green", NULL, PP_noMember },
+		{ 13, "double", "blue", NULL, PP_noMember },
+		{ 14, "double", "chroma", NULL, PP_noMember },
+		{ 15, "int", "effect", NULL, PP_noMember },
+		{ 16, "double", "speedOrPower", NULL, PP_noMember },
+
+		{ 31, "double", "goalX", NULL, PP_noMember },
+		{ 32, "double", "goalY", NULL, PP_noMember },
+		{ 33, "int", "magnify", "100", PP_noMember },
+		{ 34, "int", "trans", "0", PP_noMember },
+
+		{ 41, "int", "red", "100", PP_noMember },
+		{ 42, "int", "green", "100", PP_noMember },
+		{ 43, "int", "blue", "100", PP_noMember },
+		{ 44, "int", "chroma", "100", PP_noMember },
+		{ 46, "int", "speedOrPower", NULL, PP_noMember },
+
+		{ 51, "int", "countDown", "0", PP_noMember },
+		{ 52, "double", "degree", NULL, PP_noMember },
+		{ 53, "int", "dummy", NULL, PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_Character[] =
+	{
+		{ 1, "string", "name", NULL, PP_noMember },
+		{ 2, "string", "title", NULL, PP_noMember },
+		{ 3, "bool", "semiTrans", NULL, PP_noMember },
+
+		{ 11, "string", "charSet", NULL, PP_noMember },
+		{ 12, "int", "charSetPos", NULL, PP_noMember },
+		{ 13, "bool", "trans", NULL, PP_noMember },
+
+		{ 21, "string", "faceSet", NULL, PP_noMember },
+		{ 22, "int", "faceSetPos", NULL, PP_noMember },
+
+		{ 31, "int", "level", NULL, PP_noMember },
+		{ 32, "int", "exp", NULL, PP_noMember },
+		{ 33, "int", "HP", NULL, PP_noMember },
+		{ 34, "int", "MP", NULL, PP_noMember },
+
+		{ 41, "int", "attack", "0", PP_noMember },
+		{ 42, "int", "gaurd", "0", PP_noMember },
+		{ 43, "int", "mind", "0", PP_noMember },
+		{ 44, "int", "speed", "0", PP_noMember },
+
+		{ 51, "int", "skillDataNum", "0", PP_noMember },
+		{ 52, "Binary", "skillData", NULL, PP_noMember }, // std::set<uint16_t>
+
+		{ 61, "Binary", "equipment", NULL, PP_noMember }, // std::array<uint16_t, 5>
+
+		{ 71, "int", "curHP", "0", PP_noMember },
+		{ 72, "int", "curMP", "0", PP_noMember },
+
+		{ 81, "int", "conditionStepNum", "0", PP_noMember },
+		{ 82, "Binary", "conditionStep", NULL, PP_noMember }, // std::vector<uint16_t>
+		{ 83, "int", "conditionNum", "0", PP_noMember },
+		{ 84, "Binary", "condition", NULL, PP_noMember }, // std::vector<uint8_t>
+
+		{ 90, "int", "job", NULL, PP_noMember },
+		{ 91, "bool", "doubleHand", NULL, PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_Status[] =
+	{
+		{ 1, "int", "memberNum", "0", PP_noMember },
+		{ 2, "Binary", "member", NULL, PP_noMember },
+
+		{ 11, "int", "itemTypeNum", "0", PP_noMember },
+		{ 12, "Binary", "itemID", NULL, PP_noMember },
+		{ 13, "Binary", "itemNum", NULL, PP_noMember },
+		{ 14, "Binary", "ItemUse", NULL, PP_noMember },
+
+		{ 21, "int", "money", "0", PP_noMember },
+		// [23]:
+
+		{ 32, "int", "battle", "0", PP_noMember },
+		{ 33, "int", "loss", "0", PP_noMember },
+		{ 34, "int", "win", "0", PP_noMember },
+		{ 35, "int", "escape", "0", PP_noMember },
+
+		{ 41, "int", "dummy", NULL, PP_noMember },
+		{ 42, "Binary", "dummy", NULL, PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_Teleport[] =
+	{
+		{ 1, "int", "mapID", "0", PP_noMember },
+		{ 2, "int", "x", "0", PP_noMember },
+		{ 3, "int", "y", "0", PP_noMember },
+		{ 4, "bool", "onAfterTeleport", "false", PP_noMember },
+		{ 5, "int", "switchID", "1", PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_EventData[] =
+	{
+		{ 1, "int", "dummy", NULL, PP_noMember },
+		{ 3, "int", "encountRate", NULL, PP_noMember },
+
+		{ 5, "int", "chipSetID", NULL, PP_noMember },
+
+		{ 11, "Array2D", "info", "EventState", PP_noMember },
+
+		{ 21, "Binary", "replaceLower", NULL, PP_noMember },
+		{ 22, "Binary", "replaceUpper", NULL, PP_noMember },
+
+		{ 31, "bool", "usePanorama", NULL, PP_noMember },
+		{ 32, "string", "panorama", NULL, PP_noMember },
+		{ 33, "bool", "horizontalScroll", NULL, PP_noMember },
+		{ 34, "bool", "verticalScroll", NULL, PP_noMember },
+		{ 35, "bool", "horizontalScrollAuto", NULL, PP_noMember },
+		{ 36, "int", "horizontalScrollSpeed", NULL, PP_noMember },
+		{ 37, "bool", "verticalScrollAuto", NULL, PP_noMember },
+		{ 38, "int", "verticalScrollSpeed", NULL, PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_dummy113_dummy[] =
+	{
+		{ 1, "int", "eventLength", NULL, PP_noMember },
+		{ 2, "Event", "dummy", NULL, PP_noMember },
+
+		{ 11, "int", "dummy", NULL, PP_noMember },
+		{ 12, "int", "dummy", NULL, PP_noMember },
+		{ 13, "Event", "dummy", NULL, PP_noMember },
+
+		{ 21, "int", "dummy", NULL, PP_noMember },
+		{ 22, "int", "dummy", NULL, PP_noMember },
+
+		// [31]:
+	};
+
+	Field const LcfSaveData_Grobal_dummy113[] =
+	{
+		{ 1, "Array2D", "dummy", NULL, PP_member(LcfSaveData_Grobal_dummy113_dummy) },
+		{ 4, "int", "dummy", NULL, PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_dummy114_dummy[] =
+	{
+		{ 1, "Binary", "dummy", NULL, PP_noMember },
+	};
+
+	Field const LcfSaveData_Grobal_dummy114[] =
+	{
+		{ 1, "Array1D", "dummy", NULL, PP_member(LcfSaveData_Grobal_dummy114_dummy) },
+	};
+
+	Field const LcfSaveData_Grobal[] =
+	{
+		{ 100, "Array1D", "Preview", NULL, PP_member(LcfSaveData_Grobal_Preview) },
+
+		{ 101, "Array1D", "System", NULL, PP_member(LcfSaveData_Grobal_System) },
+
+		{ 102, "Array1D", "dummy", NULL, PP_member(LcfSaveData_Grobal_dummy) },
+
+		{ 103, "Array2D", "Picture", NULL, PP_member(LcfSaveData_Grobal_Picture) },
+
+		{ 104, "EventState", "Party", NULL, PP_noMember },
+		{ 105, "EventState", "Boat", NULL, PP_noMember },
+		{ 106, "EventState", "Ship", NULL, PP_noMember },
+		{ 107, "EventState", "Airship", NULL, PP_noMember },
+
+		{ 108, "Array2D", "Character", NULL, PP_member(LcfSaveData_Grobal_Character) },
+
+		{ 109, "Array1D", "Status", NULL, PP_member(LcfSaveData_Grobal_Status) },
+
+		{ 110, "Array2D", "Teleport", NULL, PP_member(LcfSaveData_Grobal_Teleport) },
+
+		{ 111, "Array1D", "EventData", NULL, PP_member(LcfSaveData_Grobal_EventData) },
+
+		{ 112, "Array1D", "dummy", NULL, PP_noMember },
+
+		{ 113, "Array1D", "dummy", NULL, PP_member(LcfSaveData_Grobal_dummy113) },
+
+		{ 114, "Array2D", "dummy", NULL, PP_member(LcfSaveData_Grobal_dummy114) },
+	};
+
+	Field const top[] =
+	{
+		{ 0, "Array1D", "Grobal", NULL, PP_member(LcfSaveData_Grobal) },
+	};
+} // namespace
+
+rpg2k::define::Schema const rpg2k::define::LcfSaveData = { PP_member(top) };
@@ -1,12 +1,22 @@
 #include "Define.hpp"
 
-const char* rpg2k::define::Music = (" \
-Array1D Music \n \
-{ \n \
-	[1]: string fileName; \n \
-	[2]: int fadeInTime = 0; \n \
-	[3]: int volume = 100; \n \
-	[4]: int tempo = 100; \n \
-	[5]: int balance = 50; \n \
-}; \n \
-");
+namespace
+{
+	using rpg2k::define::Field;
+
+	Field const Music_Music[] =
+	{
+		{ 1, "string", "fileName", NULL, PP_noMember },
+		{ 2, "int", "fadeInTime", "0", PP_noMember },
+		{ 3, "int", "volume", "100", PP_noMember },
+		{ 4, "int", "tempo", "100", PP_noMember },
+		{ 5, "int", "balance", "50", PP_noMember },
+	};
+
+	Field const top[] =
+	{
+		{ 0, "Array1D", "Music", NULL, PP_member(Music_Music) },
+	};
+} // namespace
+
+rpg2k::define::Schema const rpg2k::define::Music = { PP_member(top) };
@@ -1,11 +1,21 @@
 #include "Define.hpp"
 
-const char* rpg2k::define::Sound = (" \
-Array1D Sound \n \
-{ \n \
-	[1]: string fileName; \n \
-	[3]: int volume = 100; \n \
-	[4]: int tempo = 100; \n \
-	[5]: int balance = 50; \n \
-}; \n \
-");
+namespace
+{
+	using rpg2k::define::Field;
+
+	Field const Sound_Sound[] =
+	{
+		{ 1, "string", "fileName", NULL, PP_noMember },
+		{ 3, "int", "volume", "100", PP_noMember },
+		{ 4, "int", "tempo", "100", PP_noMember },
+		{ 5, "int", "balance", "50", PP_noMember },
+	};
+
+	Field const top[] =
+	{
+		{ 0, "Array1D", "Sound", NULL, PP_member(Sound_Sound) },
+	};
+} // namespace
+
+rpg2k::define::Schema const rpg2k::define::Sound = { PP_member(top) };
@@ -6,6 +6,7 @@
 
 #include <kuto/kuto_debug_menu.h>
 #include <kuto/kuto_file.h>
+#include <kuto/kuto_load_manager.h>
 #include <kuto/kuto_performance_info.h>
 #include <kuto/kuto_render_manager.h>
 #include <kuto/kuto_section_manager.h>
@@ -26,6 +27,7 @@ AppMain::AppMain()
 : virtualPad_( *addChild( std::auto_ptr<kuto::VirtualPad>( new kuto::VirtualPad() ) ) )
 , sectionManager_( *addChild( std::auto_ptr<kuto::SectionManager>( new kuto::SectionManager() ) ) )
 , performanceInfo_( *addChild( std::auto_ptr<kuto::PerformanceInfo>( new kuto::PerformanceInfo() ) ) )
+, fixedRandomSeed_(false), randomSeed_(0)
 {
 #if !RPG2K_DEBUG
 	performanceInfo_.pauseDraw(true); // これを有効にすればFPSとか出るよ
@@ -38,9 +40,12 @@ AppMain::~AppMain()
 	this->deleteReleasedChildren();
 }
 
-bool AppMain::initialize()
+bool AppMain::initialize(const char* firstSection)
 {
-	kuto::randomize();
+	if (fixedRandomSeed_)
+		kuto::randomize(randomSeed_);
+	else
+		kuto::randomize();
 	typedef std::auto_ptr<kuto::SectionHandleBase> SectionPointer;
 
 	const char* rpgRootDir = GAME_FIND_PATH;
@@ -64,6 +69,11 @@ bool AppMain::initialize()
 
 #if !RPG2K_IS_IPHONE
 	sectionManager_.addSectionHandle( SectionPointer(new kuto::SectionHandle<kuto::DebugMenu>("Debug Menu")) );
+#endif
+
+	if (firstSection && sectionManager_.beginSection(firstSection))
+		return true;
+#if !RPG2K_IS_IPHONE
 	sectionManager_.beginSection("Debug Menu");
 #endif
 
@@ -74,6 +84,7 @@ void AppMain::update()
 {
 	performanceInfo_.start();
 		performanceInfo_.startUpdate();
+			kuto::LoadManager::instance().update(); // finish asynchronous loads before tasks poll them
 			this->updateChildren();
 		performanceInfo_.endUpdate();
 		performanceInfo_.startDraw();
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <kuto/kuto_task.h>
+#include <kuto/kuto_types.h>
 
 
 namespace kuto
@@ -23,7 +24,10 @@ public:
 	~AppMain();
 
 public:
-	bool initialize();
+	/// firstSection is begun instead of the debug menu when it is given
+	bool initialize(const char* firstSection = NULL);
+	/// seeds the random numbers with seed instead of the time (for replays and tests). call before initialize()
+	void setRandomSeed(kuto::u32 seed) { fixedRandomSeed_ = true; randomSeed_ = seed; }
 	void update();
 
 	kuto::SectionManager& sectionManager() { return sectionManager_; }
@@ -35,4 +39,6 @@ private:
 	kuto::VirtualPad& 		virtualPad_;
 	kuto::SectionManager&	sectionManager_;
 	kuto::PerformanceInfo&	performanceInfo_;
+	bool					fixedRandomSeed_;
+	kuto::u32				randomSeed_;
 }; // class AppMain
@@ -100,5 +100,5 @@ void Game::returnTitle()
 
 kuto::Texture& Game::systemTexture()
 {
-	return texPool_.get( GameTexturePool::System, project_.systemGraphic().toSystem() );
+	return texPool_.get( GameTexturePool::System, project_.systemGraphic() );
 }
@@ -299,7 +299,7 @@ void GameBattle::setEscapeMessage()
 	enemiesSpeed /= enemies_.size();
 
 	int escapeRatio = (int)((1.5f - (enemiesSpeed / playersSpeed)) * 100.f) + escapeNum_ * 10;
-	escapeSuccess_ = kuto::random(100) < escapeRatio;
+	escapeSuccess_ = kuto::random(100, kuto::RANDOM_BATTLE) < escapeRatio;
 	// if (project_.config().alwaysEscape)
 	//	escapeSuccess_ = true;
 	if (firstAttack_)
@@ -394,7 +394,7 @@ GameBattleChara* GameBattle::targetRandom(GameBattleChara* attacker)
 		}
 	}
 	kuto_assert(!charaList.empty());
-	return charaList[kuto::random((int)charaList.size())];
+	return charaList[kuto::random((int)charaList.size(), kuto::RANDOM_BATTLE)];
 }
 
 void GameBattle::setAnimationMessageMagicSub(GameBattleChara* attacker, GameBattleChara* target)
@@ -686,7 +686,7 @@ void GameBattle::calcBattleOrder()
 	}
 	// sort
 	for (uint i = 0; i < battleOrder_.size(); i++) {
-		battleOrder_[i]->setAttackPriorityOffset(kuto::random(0.1f));		// add random offset
+		battleOrder_[i]->setAttackPriorityOffset(kuto::random(0.1f, kuto::RANDOM_BATTLE));		// add random offset
 	}
 	std::sort(battleOrder_.begin(), battleOrder_.end(), sortBattleOrderFunc);
 }
@@ -41,9 +41,9 @@ AttackResult GameBattleChara::attackResult(const GameBattleChara& target, const
 	case kAttackTypeAttack:
 	case kAttackTypeDoubleAttack:
 		{
-			int atk = (int)(status_.attack() * 0.5f * (kuto::random(0.4f) + 0.8f));
+			int atk = (int)(status_.attack() * 0.5f * (kuto::random(0.4f, kuto::RANDOM_BATTLE) + 0.8f));
 			result.hpDamage = kuto::max(0, atk - target.status().defence() / 4);
-			if (status_.isCharged() || kuto::random(1.f) < status_.criticalRatio()) {
+			if (status_.isCharged() || kuto::random(1.f, kuto::RANDOM_BATTLE) < status_.criticalRatio()) {
 				// critical hit!
 				result.critical = true;
 				result.hpDamage *= 3;
@@ -56,7 +56,7 @@ AttackResult GameBattleChara::attackResult(const GameBattleChara& target, const
 			}
 			int hitRatio = (int)(100 - (100 - status_.hitRatio()) *
 				(1.f + ((float)target.status().speed() / (float)status_.speed() - 1.f) / 2.f));
-			result.miss = kuto::random(100) >= hitRatio;
+			result.miss = kuto::random(100, kuto::RANDOM_BATTLE) >= hitRatio;
 			if (!result.miss) {
 				if (target.status().hp() - result.hpDamage <= 0) {
 					result.badConditions.push_back(1);	// 戦闘不能状態に
@@ -66,7 +66,7 @@ AttackResult GameBattleChara::attackResult(const GameBattleChara& target, const
 		break;
 	case kAttackTypeSuicideBombing:
 		{
-			int atk = (int)(status_.attack() * (kuto::random(0.4f) + 0.8f));
+			int atk = (int)(status_.attack() * (kuto::random(0.4f, kuto::RANDOM_BATTLE) + 0.8f));
 			result.hpDamage = kuto::max(0, atk - target.status().defence() / 2);
 			if (target.attackInfo().type == kAttackTypeDefence) {
 				if (status_.isStrongGuard())
@@ -76,7 +76,7 @@ AttackResult GameBattleChara::attackResult(const GameBattleChara& target, const
 			}
 			int hitRatio = (int)(100 - (100 - status_.hitRatio()) *
 				(1.f + ((float)target.status().speed() / (float)status_.speed() - 1.f) / 2.f));
-			result.miss = kuto::random(100) >= hitRatio;
+			result.miss = kuto::random(100, kuto::RANDOM_BATTLE) >= hitRatio;
 			if (!result.miss) {
 				if (target.status().hp() - result.hpDamage <= 0) {
 					result.badConditions.push_back(1);	// 戦闘不能状態に
@@ -88,7 +88,7 @@ AttackResult GameBattleChara::attackResult(const GameBattleChara& target, const
 		{
 			const Array1D& skill = project_.getLDB().skill()[attackInfo.id];
 			int baseValue = skill[24].to<int>() + (status_.attack() * skill[21].to<int>() / 20) + (status_.magic() * skill[22].to<int>() / 40);
-			baseValue += (int)(baseValue * (kuto::random(1.f) - 0.5f) * skill[23].to<int>() * 0.1f);
+			baseValue += (int)(baseValue * (kuto::random(1.f, kuto::RANDOM_BATTLE) - 0.5f) * skill[23].to<int>() * 0.1f);
 			if (skill[12].to<int>() < 2) {
 				if (!skill[38].to<bool>()) {
 					baseValue -= (target.status().defence() * skill[21].to<int>() / 40) + (target.status().magic() * skill[22].to<int>() / 80);
@@ -115,7 +115,7 @@ AttackResult GameBattleChara::attackResult(const GameBattleChara& target, const
 				hitRatio = (int)(100 - (100 - status_.hitRatio()) *
 					(1.f + ((float)target.status().speed() / (float)status_.speed() - 1.f) / 2.f));
 			}
-			result.miss = kuto::random(100) >= hitRatio;
+			result.miss = kuto::random(100, kuto::RANDOM_BATTLE) >= hitRatio;
 			if (!result.miss) {
 				rpg2k::Binary const& cond = skill[42];
 				for (uint i = 0; i < cond.size(); i++) {
@@ -161,10 +161,10 @@ AttackResult GameBattleChara::attackResult(const GameBattleChara& target, const
 	default:
 		{
 			result.hpDamage = kuto::max(0, status_.attack() / 2 - target.status().defence() / 4);
-			result.hpDamage = (int)(result.hpDamage * (kuto::random(0.4f) + 0.8f));
+			result.hpDamage = (int)(result.hpDamage * (kuto::random(0.4f, kuto::RANDOM_BATTLE) + 0.8f));
 			int hitRatio = (int)(100 - (100 - status_.hitRatio()) *
 				(1.f + ((float)target.status().speed() / (float)status_.speed() - 1.f) / 2.f));
-			result.miss = kuto::random(100) >= hitRatio;
+			result.miss = kuto::random(100, kuto::RANDOM_BATTLE) >= hitRatio;
 		}
 		break;
 	}
@@ -222,7 +222,7 @@ void GameBattleChara::updateBadCondition()
 			const Array1D& cond = project_.getLDB().condition()[status_.badConditions()[i].id];
 			status_.badConditions()[i].count++;
 			if (status_.badConditions()[i].count > cond[21].to<int>()) {
-				if (cond[22].to<int>() > kuto::random(100)) {
+				if (cond[22].to<int>() > kuto::random(100, kuto::RANDOM_BATTLE)) {
 					status_.removeBadCondition(i);
 					continue;
 				}
@@ -387,7 +387,7 @@ void GameBattleEnemy::setAttackInfoAuto(const GameBattlePlayerList& targets
 		priorityMax += attackPattern[ pattern[i] ][13].to<int>();
 	}
 	int attackIndex = -1;
-	int priRange = kuto::random(priorityMax);
+	int priRange = kuto::random(priorityMax, kuto::RANDOM_BATTLE);
 	for (uint i = 0; i < pattern.size(); i++) {
 		priRange -= attackPattern[ pattern[i] ][13].to<int>();
 		if (priRange < 0) {
@@ -399,7 +399,7 @@ void GameBattleEnemy::setAttackInfoAuto(const GameBattlePlayerList& targets
 		const Array1D& pt = attackPattern[ pattern[attackIndex] ];
 		switch (pt[1].to<int>()) {
 		case 0:		// 基本行動
-			info.target = targets[kuto::random(targets.size())];
+			info.target = targets[kuto::random(targets.size(), kuto::RANDOM_BATTLE)];
 			switch (pt[2].to<int>()) {
 			case 0:		// 通常攻撃
 				info.type = kAttackTypeAttack;
@@ -433,13 +433,13 @@ void GameBattleEnemy::setAttackInfoAuto(const GameBattlePlayerList& targets
 				const Array1D& skill = project_.getLDB().skill()[pt[3].to<int>()];
 				switch (skill[12].to<int>()) {
 				case 0: // enemy single
-					info.target = targets[kuto::random(targets.size())];
+					info.target = targets[kuto::random(targets.size(), kuto::RANDOM_BATTLE)];
 					break;
 				case 2: // user
 					info.target = this;
 					break;
 				case 3: // party single
-					info.target = party[kuto::random(party.size())];
+					info.target = party[kuto::random(party.size(), kuto::RANDOM_BATTLE)];
 					break;
 				default:
 					info.target = NULL;
@@ -455,7 +455,7 @@ void GameBattleEnemy::setAttackInfoAuto(const GameBattlePlayerList& targets
 			break;
 		}
 	} else {
-		info.target = targets[kuto::random(targets.size())];
+		info.target = targets[kuto::random(targets.size(), kuto::RANDOM_BATTLE)];
 		info.type = kAttackTypeAttack;
 		info.id = 0;
 	}
@@ -487,7 +487,7 @@ int GameBattleEnemy::resultMoney() const
 int GameBattleEnemy::resultItem() const
 {
 	const Array1D& enemy = project_.getLDB().enemy()[enemyId_];
-	if (kuto::random(100) < enemy[14].to<int>()) return enemy[13];
+	if (kuto::random(100, kuto::RANDOM_BATTLE) < enemy[14].to<int>()) return enemy[13];
 	return 0;
 }
 
@@ -505,7 +505,7 @@ void GameBattlePlayer::setAttackInfoAuto(const GameBattleEnemyList& targets, con
 	AttackInfo info;
 	switch (actionLimit()) {
 	case 0:
-		info.target = targets[kuto::random(targets.size())];
+		info.target = targets[kuto::random(targets.size(), kuto::RANDOM_BATTLE)];
 		info.type = status_.isDoubleAttack()? kAttackTypeDoubleAttack : kAttackTypeAttack;
 		info.id = 0;
 		break;
@@ -515,12 +515,12 @@ void GameBattlePlayer::setAttackInfoAuto(const GameBattleEnemyList& targets, con
 		info.id = 0;
 		break;
 	case 2:
-		info.target = targets[kuto::random(targets.size())];
+		info.target = targets[kuto::random(targets.size(), kuto::RANDOM_BATTLE)];
 		info.type = status_.isDoubleAttack()? kAttackTypeDoubleAttack : kAttackTypeAttack;
 		info.id = 0;
 		break;
 	case 3:
-		info.target = party[kuto::random(party.size())];
+		info.target = party[kuto::random(party.size(), kuto::RANDOM_BATTLE)];
 		info.type = status_.isDoubleAttack()? kAttackTypeDoubleAttack : kAttackTypeAttack;
 		info.id = 0;
 		break;
@@ -436,7 +436,7 @@ bool GameCharaStatus::applySkill(int skillId, GameCharaStatus* owner)
 		{
 			AttackResult result;
 			int baseValue = skill[24].to<int>() + (owner->attack() * skill[21].to<int>() / 20) + (owner->magic() * skill[22].to<int>() / 40);
-			baseValue += (int)(baseValue * (kuto::random(1.f) - 0.5f) * skill[25].to<int>() * 0.1f);
+			baseValue += (int)(baseValue * (kuto::random(1.f, kuto::RANDOM_BATTLE) - 0.5f) * skill[25].to<int>() * 0.1f);
 			result.cure = true;
 			baseValue = kuto::max(0, baseValue);
 			if (skill[31].to<bool>()) result.hpDamage = baseValue;
@@ -451,7 +451,7 @@ bool GameCharaStatus::applySkill(int skillId, GameCharaStatus* owner)
 				hitRatio = (int)(100 - (100 - owner->hitRatio()) *
 					(1.f + ((float)speed() / (float)owner->speed() - 1.f) / 2.f));
 			}
-			result.miss = kuto::random(100) >= hitRatio;
+			result.miss = kuto::random(100, kuto::RANDOM_BATTLE) >= hitRatio;
 			if (!result.miss) {
 				rpg2k::Binary const& cond = skill[42];
 				for (uint i = 0; i < cond.size(); i++) {
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstdlib>
 #include <deque>
 #include <iterator>
 #include <sstream>
@@ -226,7 +228,7 @@ PP_protoType(CODE_OPERATE_VAR)
 		value = lsd.var(lsd.var(com[5]));
 		break;
 	case 3:		// [乱数] C〜Dの範囲の乱数
-		value = rpg2k::random(com[5], com[6]);
+		value = kuto::random(std::abs(com[6] - com[5]) + 1, kuto::RANDOM_EVENT) + std::min(com[5], com[6]);
 		break;
 	case 4:		// [アイテム]
 		switch( com[6] ) {
@@ -865,19 +867,15 @@ PP_protoType(CODE_EVENT_SWAP)
 	EventState& stateA = lsd.eventState(com[0]);
 	EventState& stateB = lsd.eventState(com[1]);
 
-	uint xBuff = stateA.x(), yBuff = stateA.y();
+	kuto::Point2 const posA( stateA.x(), stateA.y() ), posB( stateB.x(), stateB.y() );
 
-	stateA[12] = stateB.x();
-	stateA[13] = stateB.y();
-
-	stateB[12] = xBuff;
-	stateB[13] = yBuff;
+	field_.map().move(com[0], posB);
+	field_.map().move(com[1], posA);
 }
 
 PP_protoType(CODE_EVENT_LOCATE)
 {
 	SaveData& lsd = *cache_.lsd;
-	EventState& state = lsd.eventState(com[0]);
 
 	uint x, y;
 	switch(com[1]) {
@@ -892,8 +890,7 @@ PP_protoType(CODE_EVENT_LOCATE)
 		default: kuto_assert(false);
 	}
 
-	state[12] = x;
-	state[13] = y;
+	field_.map().move( com[0], kuto::Point2(x, y) );
 }
 
 PP_protoType(CODE_PARTY_NAME)
@@ -1387,7 +1384,7 @@ PP_protoType(CODE_PARTY_DAMAGE)
 	TargetCharacter const target = targetCharacter(Target::Type(com[0]), com[1]);
 	for(TargetCharacter::const_iterator it = target.begin(); it < target.end(); ++it) {
 		int result =
-			( float(com[2]) * ( 1.f + kuto::random(float(com[5]) * 0.1f) - float(com[5]) * 0.05f ) )
+			( float(com[2]) * ( 1.f + kuto::random(float(com[5]) * 0.1f, kuto::RANDOM_EVENT) - float(com[5]) * 0.05f ) )
 			- proj.paramWithEquip(*it, rpg2k::Param::GAURD) * float(com[3]) * 0.01f
 			- proj.paramWithEquip(*it, rpg2k::Param::MIND ) * float(com[4]) * 0.01f
 			;
@@ -14,6 +14,7 @@
 #include <rpg2k/Debug.hpp>
 #include <rpg2k/Event.hpp>
 
+#include <algorithm>
 #include <sstream>
 
 using rpg2k::structure::Array1D;
@@ -55,11 +56,18 @@ void GameEventManager::Context::start(rpg2k::structure::Event const& ev)
 {
 	clearCallStack();
 	eventStack_.push( std::make_pair(&ev, 0) );
+
+	maps_.clear();
+	if(eventID_ != 0) { maps_.insert( owner_.cache_.project->currentMapID() ); }
 }
 void GameEventManager::Context::call(rpg2k::structure::Event const& ev, Pointer const& p)
 {
 	kuto_assert( eventStack_.size() < unsigned(rpg2k::EV_STACK_MAX) );
 	eventStack_.push( std::make_pair(&ev, p) );
+
+	// a common event pins the current map too, which only keeps it loaded a little longer
+	maps_.insert( owner_.cache_.project->currentMapID() );
+	owner_.pinMaps();
 }
 void GameEventManager::Context::ret() // return
 {
@@ -90,29 +98,29 @@ void GameEventManager::Context::update()
 void GameEventManager::Context::skipToEndOfJunction(unsigned const nest, unsigned const code)
 {
 	std::pair<rpg2k::structure::Event const*, Pointer>& cur = eventStack_.top();
+	rpg2k::structure::Event const& ev = *cur.first;
+	if( cur.second >= ev.size() ) return;
+
 	unsigned const codeAttrib = code % 10000 / 10;
-	for( ; cur.second < cur.first->size(); ++cur.second) {
-		if(
-			( (*cur.first)[cur.second].nest() == nest ) ||
-			( ( (*cur.first)[cur.second].code() % 10000 / 10 ) != codeAttrib )
-		) { ++cur.second; return; }
-	}
+	Pointer const end = ( ( ev[cur.second].code() % 10000 / 10 ) != codeAttrib )
+		? cur.second : std::min( ev.findNest(cur.second, nest), ev.groupEnd(cur.second) );
+	cur.second = (end < ev.size())? end + 1 : ev.size();
 }
 bool GameEventManager::Context::skipToElse(unsigned const nest, unsigned const code)
 {
 	std::pair<rpg2k::structure::Event const*, Pointer>& cur = eventStack_.top();
-
-	for( ; cur.second < cur.first->size(); ++cur.second) {
-		if( (*cur.first)[cur.second].nest() == nest ) {
-			if( (*cur.first)[cur.second].code() == 10 ) {
-				++cur.second;
-				return false;
-			} else if( (*cur.first)[cur.second].code() == code ) {
-				++cur.second;
-				return true;
-			}
+	rpg2k::structure::Event const& ev = *cur.first;
+
+	for(Pointer p = ev.findNest(cur.second, nest); p < ev.size(); p = ev.nextNest(p)) {
+		if( ev[p].code() == 10 ) {
+			cur.second = p + 1;
+			return false;
+		} else if( ev[p].code() == code ) {
+			cur.second = p + 1;
+			return true;
 		}
 	}
+	cur.second = std::max( cur.second, ev.size() );
 	return false;
 }
 void GameEventManager::Context::startLoop(Nest const& n)
@@ -182,6 +190,16 @@ void GameEventManager::addContext(unsigned const evID
 , rpg2k::structure::Event const& ev, rpg2k::EventStart::Type const t)
 {
 	contextList_.insert( t, std::auto_ptr<Context>( new Context(*this, evID, t) ) )->second->start(ev);
+	pinMaps();
+}
+void GameEventManager::pinMaps()
+{
+	// teleports don't evict the maps of running events, they point into them
+	std::set<unsigned> maps;
+	for(ContextList::const_iterator it = contextList_.begin(); it != contextList_.end(); ++it) {
+		maps.insert( it->second->maps().begin(), it->second->maps().end() );
+	}
+	cache_.project->pinLMU(maps);
 }
 void GameEventManager::updateCommonContext()
 {
@@ -265,6 +283,7 @@ void GameEventManager::update()
 
 		if( it->second->stackEmpty() ) { contextList_.erase(it); }
 	}
+	pinMaps();
 
 	if( contextList_.empty() ) { eventLeft_ = false; }
 }
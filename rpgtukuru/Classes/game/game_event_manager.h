@@ -111,19 +111,20 @@ private:
 		void update();
 
 		bool stackEmpty() const { return eventStack_.empty(); }
+		std::set<unsigned> const& maps() const { return maps_; }
 
-		rpg2k::structure::Instruction const& operator ++() { return event()[++eventStack_.top().second]; }
-		rpg2k::structure::Instruction const& next() const
+		rpg2k::structure::Instruction operator ++() { return event()[++eventStack_.top().second]; }
+		rpg2k::structure::Instruction next() const
 		{
 			return (*eventStack_.top().first)[eventStack_.top().second + 1];
 		}
 
 	private:
-		rpg2k::structure::Instruction const& current() const
+		rpg2k::structure::Instruction current() const
 		{
 			return (*eventStack_.top().first)[eventStack_.top().second];
 		}
-		rpg2k::structure::Instruction const& previous() const
+		rpg2k::structure::Instruction previous() const
 		{
 			return (*eventStack_.top().first)[eventStack_.top().second - 1];
 		}
@@ -135,6 +136,7 @@ private:
 		rpg2k::EventStart::Type const type_;
 		std::stack< std::pair<rpg2k::structure::Event const*, Pointer> > eventStack_;
 		std::stack< std::pair<Nest, Pointer> > loopStack_;
+		std::set<unsigned> maps_; // maps the events on the stack belong to
 	}; // class Context
 
 private:
@@ -178,6 +180,7 @@ private:
 	void setWaitCount(unsigned c);
 
 	void addContext(unsigned evID, rpg2k::structure::Event const& ev, rpg2k::EventStart::Type t);
+	void pinMaps();
 	void updateCommonContext();
 	void updateMapContext();
 
@@ -27,7 +27,7 @@ namespace GameExpression
 	) {
 		return
 			(powerA * 0.5f - defenceB * 0.25f) *
-			( kuto::random(0.4f) + 0.8f ) *
+			( kuto::random(0.4f, kuto::RANDOM_BATTLE) + 0.8f ) *
 			(critical? 3.f : 1.f) *
 			( commandDefend? (strongDefence? 0.25f : 0.5f) : 1.f );
 	}
@@ -60,7 +60,7 @@ namespace GameExpression
 					basicEffect
 					+ (powerA * blowRelate * 0.05f )
 					+ ( mindA * mindRelate * 0.025f)
-				) * ( 1.f + kuto::random(spread * 0.1f) - spread * 0.05f )
+				) * ( 1.f + kuto::random(spread * 0.1f, kuto::RANDOM_BATTLE) - spread * 0.05f )
 				- (
 					(powerB * blowRelate * 0.025f ) +
 					( mindB * mindRelate * 0.0125f)
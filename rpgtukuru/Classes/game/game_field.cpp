@@ -5,11 +5,16 @@
  */
 
 #include <kuto/kuto_file.h>
+#include <kuto/kuto_font.h>
+#include <kuto/kuto_random.h>
+
+#include <rpg2k/Event.hpp>
 
 #include "game.h"
 #include "game_battle.h"
 #include "game_chara_status.h"
 #include "game_debug_menu.h"
+#include "game_event_command.h"
 #include "game_event_manager.h"
 #include "game_fade_effect.h"
 #include "game_field.h"
@@ -34,8 +39,11 @@ GameField::GameField(Game& parent, unsigned const saveId)
 	if (
 		rpg2k::ID_MIN <= saveId &&
 		saveId <= rpg2k::SAVE_DATA_MAX &&
-		project_.getLSD(saveId).exists()
-	) { project_.loadLSD(saveId); }
+		project_.getLSDPreview(saveId).exists()
+	) {
+		project_.loadLSD(saveId);
+		kuto::setRandomState(project_.getLSD().randomState());	// battles and movement continue as they were saved
+	}
 	else { project_.newGame(); }
 
 	rpg2k::structure::EventState& party = project_.getLSD().party();
@@ -77,6 +85,7 @@ void GameField::update()
 {
 	switch (state_) {
 	case kStateField:
+		prefetchMap();
 		break;
 	case kStateBattleStart:
 		if (fadeEffect_.state() == GameFadeEffect::kStateFadeOutEnd) {
@@ -116,6 +125,7 @@ void GameField::update()
 			playerLeader()->updateMapPosition();
 			 */
 
+			prewarmFont();	// screen is black here so the glyph uploads go unnoticed
 			map_.pauseUpdate(false);
 			eventManager_.pauseUpdate(false);
 			fadeEffect_.start((GameFadeEffect::FadeType)fadeInfos_[kFadePlaceMapShow], GameFadeEffect::kStateFadeIn);
@@ -245,6 +255,52 @@ void GameField::changeMap(int mapId, int x, int y)
 	map_.moveMap(mapId, x, y);
 }
 
+void GameField::prefetchMap()
+{
+	// loads the chip set of one teleport destination a frame so that moving there doesn't stall
+	unsigned const mapId = project_.prefetchLMU();
+	if (mapId == rpg2k::INVALID_ID)
+		return;
+
+	unsigned const chipSetId = rpg2k::model::MapUnit::chipSetID(project_.gameDir(), mapId);
+	rpg2k::structure::Array1D const& chipSet = project_.getLDB().chipSet()[chipSetId];
+	game_.texPool().prefetch( GameTexturePool::ChipSet, rpg2k::structure::ChipSet(chipSet).chipSet() );
+}
+
+void GameField::prewarmFont()
+{
+	// puts the glyphs of the vocabulary and the current map's messages in the font atlas
+	// so that the first message window doesn't rasterize them while it is shown
+	kuto::Font& font = kuto::Font::instance();
+	rpg2k::model::DataBase const& ldb = project_.getLDB();
+	for (unsigned i = 0; i < ldb.vocabularySize(); i++) {
+		font.prewarm( ldb.vocabulary(i).toSystem().c_str() );
+	}
+
+	unsigned const mapId = project_.currentMapID();
+	if (mapId == rpg2k::INVALID_ID)
+		return;
+
+	rpg2k::structure::Array2D const& events = project_.getLMU(mapId).event();
+	for (rpg2k::structure::Array2D::ConstIterator ev = events.begin(); ev != events.end(); ++ev) {
+		if ( !ev->second->exists() ) continue;
+
+		rpg2k::structure::Array2D const& pages = (*ev->second)[5];
+		for (rpg2k::structure::Array2D::ConstIterator page = pages.begin(); page != pages.end(); ++page) {
+			if ( !page->second->exists() ) continue;
+
+			rpg2k::structure::Event const& event = (*page->second)[52];
+			for (unsigned i = 0; i < event.size(); i++) {
+				switch (event[i].code()) {
+				case CODE_TXT_SHOW: case CODE_TXT_SHOW_ADD: case CODE_SELECT_START:
+					font.prewarm( event[i].string().toSystem().c_str() );
+					break;
+				}
+			}
+		}
+	}
+}
+
 void GameField::fadeOut(int type)
 {
 	fadeEffectScreen_.start((GameFadeEffect::FadeType)(type == -1? fadeInfos_[kFadePlaceMapHide] : type), GameFadeEffect::kStateFadeOut);
@@ -74,6 +74,8 @@ private:
 
 	virtual bool initialize();
 	virtual void update();
+	void prefetchMap();
+	void prewarmFont();
 
 private:
 	Game&				game_;
@@ -22,6 +22,7 @@
 #include <boost/array.hpp>
 
 #include <bitset>
+#include <set>
 #include <utility>
 
 using rpg2k::model::MapUnit;
@@ -29,6 +30,8 @@ using rpg2k::model::Project;
 using rpg2k::model::SaveData;
 using rpg2k::structure::Array1D;
 using rpg2k::structure::Array2D;
+using rpg2k::structure::ChipSet;
+using rpg2k::structure::EventPage;
 using rpg2k::structure::EventState;
 
 
@@ -55,16 +58,6 @@ kuto::Point2 GameMap::directionAdd(rpg2k::CharSet::Dir::Type const t)
 
 namespace
 {
-	typedef std::multimap<unsigned, unsigned>::const_iterator x_it;
-	typedef std::vector< std::multimap<unsigned, unsigned> >::const_iterator y_it;
-	typedef std::vector< std::vector< std::multimap<unsigned, unsigned> > >::const_iterator priority_it;
-
-	bool eventExists(std::vector< std::multimap<unsigned, unsigned> > const& target, kuto::Point2 const& pos)
-	{
-		std::multimap<unsigned, unsigned> const& line = target[pos.y];
-		return( line.find(pos.x) != line.end() );
-	}
-
 	kuto::Vector2 const
 		SCREEN_SIZE(320.f, 240.f), CHIP_SIZE(16.f, 16.f), CHAR_SIZE(24.f, 32.f);
 	kuto::Point2 const CHIP_NUM(SCREEN_SIZE.x / CHIP_SIZE.x, SCREEN_SIZE.y / CHIP_SIZE.y);
@@ -94,9 +87,12 @@ GameMap::GameMap(GameField& field)
 , screenOffset_(0.f, 0.f), screenScale_(1.f, 1.f)
 , enableScroll_(false), scrolled_(false), scrollRatio_(1.f)
 , panoramaAutoScrollOffset_(0.f, 0.f)
-, counter_(0), justMoved_(false)
+, counter_(0)
+, conditionRevision_(0), pageValid_(false)
+, justMoved_(false)
 , partyObj_( *addChild( kuto::TaskCreatorParam1<GameParty, GameMap&>::createTask(*this) ) )
 {
+	chipCache_.valid = false;
 	updateCache();
 }
 
@@ -116,6 +112,8 @@ void GameMap::moveMap(unsigned const mapID, unsigned const x, unsigned const y)
 	pageNo_.resize( objects_.size() );
 
 	updateCache();
+	chipCache_.valid = false;
+	resetEventIndex();
 
 	justMoved_ = true;
 }
@@ -140,49 +138,30 @@ void GameMap::update()
 	if( objects_.empty() ) return;
 
 	Project& proj = *cache_.project;
-	MapUnit& lmu = *cache_.lmu;
 	SaveData& lsd = *cache_.lsd;
 
-	eventMap_.clear();
-	eventMap_.resize( rpg2k::EventPriority::END, std::vector< std::multimap<unsigned, unsigned> >( lmu.height() ) );
-	std::fill_n( pageNo_.begin(), pageNo_.size(), 0 );
+	if( eventCells_.size() != unsigned(cache_.mapSize.x * cache_.mapSize.y) ) { resetEventIndex(); }
 
 	while( !touchFromEvent_.empty() ) touchFromEvent_.pop();
 	while( !touchFromParty_.empty() ) touchFromParty_.pop();
 	while( !keyEnter_.empty() ) keyEnter_.pop();
 
-	Array2D& eventStates = lsd.eventState();
-	Array2D const& mapEvents = lmu[81];
 // mapping events
-	for(Array2D::ConstIterator it = mapEvents.begin(); it != mapEvents.end(); ++it) {
-		if( !it->second->exists() ) continue;
-
-		int const evID = it->first;
-		Array1D const& event = mapEvents[evID];
-		EventState& state = reinterpret_cast<EventState&>( eventStates[evID] );
-
-		Array1D const* page = proj.currentPage(event[5]);
-		objects_[evID]->pauseUpdate(page == NULL);
-		if(page == NULL) continue;
-
-		unsigned const pageID = page->index();
-		objects_[evID]->setPage(*page, state);
-
-		pageNo_[evID] = pageID;
-
-		int const x = state.exists(12)? state.x() : event[2];
-		int const y = state.exists(13)? state.y() : event[3];
-
-		eventMap_[(*page)[34].to<int>()][y].insert( std::make_pair(x, evID) );
+	if( !pageValid_ ) { updatePages(); }
+	else if( conditionRevision_ != lsd.conditionRevision() ) {
+		std::set<unsigned> dirty;
+		proj.dirtyPages(dirty);
+		for(std::set<unsigned>::const_iterator it = dirty.begin(); it != dirty.end(); ++it) {
+			if( rpg2k::isEvent(*it) && (*it < objects_.size()) && objects_[*it] ) updatePage(*it);
+		}
+		conditionRevision_ = lsd.conditionRevision();
 	}
 // mapping non-events
 	for(uint i = rpg2k::ID_PARTY; i <= rpg2k::ID_AIRSHIP; i++) {
 		EventState& state = lsd.eventState(i);
-		if( state.mapID() != cache_.party->mapID() ) { continue; }
+		if( state.mapID() != cache_.party->mapID() ) { removeEventIndex(i); continue; }
 
-		int const x = state.x(); int const y = state.y();
-
-		eventMap_[rpg2k::EventPriority::CHAR][y].insert( std::make_pair(x, i) );
+		setEventIndex( i, rpg2k::EventPriority::CHAR, kuto::Point2( state.x(), state.y() ) );
 
 		if(i == rpg2k::ID_PARTY) {
 			// TODO
@@ -204,14 +183,12 @@ void GameMap::update()
 		kuto::Point2 const cur( party().x(), party().y() );
 		kuto::Point2 const nxt = cur + directionAdd( party().eventDir() );
 		#define PP_check(PRIORITY, POINT) \
-			for( \
-				x_it it = eventMap_[PRIORITY][POINT.y].find(POINT.x); \
-				( it != eventMap_[PRIORITY][POINT.y].end() ) && ( it->first == unsigned(POINT.x) ); ++it \
-			) { \
+			for(int s = eventAt(POINT); s != NO_EVENT; s = eventEntries_[s].next) { \
+				unsigned const evID = eventEntries_[s].evID; \
 				if( \
-					rpg2k::isEvent(it->second) && \
-					page(it->second)[33].to<int>() == rpg2k::EventStart::KEY_ENTER \
-				) keyEnter_.push(it->second); \
+					(eventEntries_[s].priority == PRIORITY) && rpg2k::isEvent(evID) && \
+					EventPage( page(evID) ).startType() == rpg2k::EventStart::KEY_ENTER \
+				) keyEnter_.push(evID); \
 			}
 		PP_check(rpg2k::EventPriority::BELOW, cur)
 		PP_check(rpg2k::EventPriority::CHAR , nxt)
@@ -220,6 +197,113 @@ void GameMap::update()
 	}
 }
 
+void GameMap::updatePages()
+{
+	SaveData& lsd = *cache_.lsd;
+
+	Array2D const& mapEvents = (*cache_.lmu)[81];
+	for(Array2D::ConstIterator it = mapEvents.begin(); it != mapEvents.end(); ++it) {
+		if( it->second->exists() ) updatePage(it->first);
+	}
+
+	lsd.clearConditionChange();
+	conditionRevision_ = lsd.conditionRevision();
+	pageValid_ = true;
+}
+
+void GameMap::updatePage(unsigned const evID)
+{
+	Array1D const& event = (*cache_.lmu)[81].toArray2D()[evID];
+	EventState& state = reinterpret_cast<EventState&>( cache_.lsd->eventState()[evID] );
+
+	Array1D const* page = cache_.project->currentPage(event[5]);
+	objects_[evID]->pauseUpdate(page == NULL);
+	if(page == NULL) {
+		pageNo_[evID] = 0;
+		removeEventIndex(evID);
+		return;
+	}
+
+	unsigned const pageID = page->index();
+	objects_[evID]->setPage(*page, state);
+
+	pageNo_[evID] = pageID;
+
+	int const x = state.exists(EventState::X)? state.x() : event[2];
+	int const y = state.exists(EventState::Y)? state.y() : event[3];
+
+	setEventIndex( evID, EventPage(*page).priority(), kuto::Point2(x, y) );
+}
+
+void GameMap::resetEventIndex()
+{
+	EventIndexEntry const empty = { 0, 0, kuto::Point2(0, 0), NO_EVENT, false };
+	eventEntries_.assign( objects_.size() + (rpg2k::ID_AIRSHIP - rpg2k::ID_PARTY + 1), empty );
+	eventCells_.assign( cache_.mapSize.x * cache_.mapSize.y, NO_EVENT );
+	CharSetHandle const noCharSet = { rpg2k::RPG2kString(), 0, false };
+	charSets_.assign( eventEntries_.size(), noCharSet );
+	std::fill( pageNo_.begin(), pageNo_.end(), 0 );
+	pageValid_ = false;
+}
+
+unsigned GameMap::eventSlot(unsigned const evID) const
+{
+	if( rpg2k::isEvent(evID) ) {
+		kuto_assert( evID < objects_.size() );
+		return evID;
+	} else return objects_.size() + (evID - rpg2k::ID_PARTY);
+}
+
+void GameMap::removeEventIndex(unsigned const evID)
+{
+	EventIndexEntry& entry = eventEntries_[ eventSlot(evID) ];
+	if( !entry.active ) return;
+
+	int const slot = eventSlot(evID);
+	int* link = &eventCells_[cache_.mapSize.x * entry.pos.y + entry.pos.x];
+	while(*link != slot) {
+		kuto_assert(*link != NO_EVENT);
+		link = &eventEntries_[*link].next;
+	}
+	*link = entry.next;
+
+	entry.next = NO_EVENT;
+	entry.active = false;
+}
+
+void GameMap::setEventIndex(unsigned const evID, unsigned const priority, kuto::Point2 const& pos)
+{
+	int const slot = eventSlot(evID);
+	EventIndexEntry& entry = eventEntries_[slot];
+	if( entry.active && (entry.priority == priority) && (entry.pos == pos) ) return;
+
+	removeEventIndex(evID);
+	kuto_assert( rpg2k::within(pos.x, cache_.mapSize.x) && rpg2k::within(pos.y, cache_.mapSize.y) );
+
+	entry.evID = evID;
+	entry.priority = priority;
+	entry.pos = pos;
+	entry.active = true;
+	// keep evID order in a cell
+	int* link = &eventCells_[cache_.mapSize.x * pos.y + pos.x];
+	while( (*link != NO_EVENT) && (eventEntries_[*link].evID < evID) ) { link = &eventEntries_[*link].next; }
+	entry.next = *link;
+	*link = slot;
+}
+
+bool GameMap::eventExists(unsigned const priority, kuto::Point2 const& pos) const
+{
+	for(int s = eventAt(pos); s != NO_EVENT; s = eventEntries_[s].next) {
+		if(eventEntries_[s].priority == priority) return true;
+	}
+	return false;
+}
+
+EventState& GameMap::eventState(unsigned const evID)
+{
+	return rpg2k::isEvent(evID)? objects_[evID]->state() : cache_.lsd->eventState(evID);
+}
+
 void GameMap::render(kuto::Graphics2D& g) const
 {
 	if(justMoved_) return;
@@ -257,27 +341,23 @@ void GameMap::render(kuto::Graphics2D& g) const
 	PP_check(0x01, y) // vertical
 	#undef PP_check
 
-	kuto::Texture const& chipSetTex = field_.game().texPool().get(
-		GameTexturePool::ChipSet, proj.chipSet()[2].to_string().toSystem() );
+	if(
+		!chipCache_.valid || (chipCache_.base != baseP) ||
+		(chipCache_.lmu != &lmu) || (chipCache_.mapID != lmu.id()) ||
+		( chipCache_.chipSetID != unsigned( proj.chipSetID() ) ) ||
+		(chipCache_.replaceRevision != cache_.lsd->replaceRevision())
+	) { bakeChipLayers(baseP); }
+
+	kuto::Texture const& chipSetTex = field_.game().texPool().get(chipCache_.chipSet);
 	rpg2k_assert( chipSetTex.isValid() );
 
 	kuto::Point2 it;
 	for(it.y = 0; it.y < CHIP_NUM.y; it.y++) {
-		std::bitset<32> aboveLw, aboveUp;
-		boost::array<unsigned, 32> lw, up;
+		ChipQuads::const_iterator const rowBegin = chipCache_.quads.begin();
 
 		// below chips
-		for(it.x = 0; it.x < CHIP_NUM.x; it.x++) {
-			kuto::Point2 const cur = (baseP + it) % mapS;
-			up[it.x] = lmu.chipIDUp(cur.x, cur.y);
-			lw[it.x] = lmu.chipIDLw(cur.x, cur.y);
-			aboveUp[it.x] = isAbove(up[it.x]);
-			aboveLw[it.x] = isAbove(lw[it.x]);
-
-			kuto::Vector2 const itVec( float(it.x), float(it.y) );
-			if( !aboveLw[it.x] ) { drawChip(g, chipSetTex, CHIP_SIZE*itVec + baseVec, lw[it.x]); }
-			if( !aboveUp[it.x] ) { drawChip(g, chipSetTex, CHIP_SIZE*itVec + baseVec, up[it.x]); }
-		}
+		drawChipQuads(g, chipSetTex
+		, rowBegin + chipCache_.rows[it.y*2 + 0], rowBegin + chipCache_.rows[it.y*2 + 1]);
 
 		// event graphics
 		boost::array< std::pair<unsigned, unsigned>, 2 > range = { {
@@ -288,29 +368,30 @@ void GameMap::render(kuto::Graphics2D& g) const
 			range[1].second = range[0].second;
 			range[0].second = mapS.x;
 		}
-		for(priority_it prIt = eventMap_.begin(); prIt != eventMap_.end(); ++prIt) {
-			std::multimap<unsigned, unsigned> const& base = (*prIt)[ (baseP.y + it.y) % mapS.y ];
+		for(unsigned pr = rpg2k::EventPriority::BEGIN; pr < rpg2k::EventPriority::END; pr++) {
+			kuto::Point2 cell( 0, (baseP.y + it.y) % mapS.y );
 
 			for(unsigned r = 0; r < range.size(); r++) {
 				if( range[r].first == range[r].second ) continue;
 
-				for(x_it x = base.begin(); x != base.end(); ++x) {
-					if(x->first < range[r].first) continue;
-					if(range[r].second <= x->first) break;
+				for(cell.x = range[r].first; unsigned(cell.x) < range[r].second; cell.x++)
+				for(int s = eventAt(cell); s != NO_EVENT; s = eventEntries_[s].next) {
+					if(eventEntries_[s].priority != pr) continue;
+					unsigned const evID = eventEntries_[s].evID;
 
 					static kuto::Vector2 CHAR_SET_OFFSET(
 						(CHAR_SIZE.x-CHIP_SIZE.x)/2, CHAR_SIZE.y - CHIP_SIZE.y );
+					it.x = cell.x - range[r].first;
 
-					if( rpg2k::isEvent(x->second) ) {
-						GameMapObject& ob = *objects_[x->second];
+					if( rpg2k::isEvent(evID) ) {
+						GameMapObject& ob = *objects_[evID];
 						if( ob.isPauseUpdate() ) continue;
 						EventState& state = ob.state();
-						it.x = x->first - range[r].first;
 
 						kuto::Vector2 const itVec( float(it.x), float(it.y) );
-						if( !state.exists(73) || !state[73].to_string().empty() ) {
+						if( !state.exists(EventState::CHAR_SET) || !state.charSet().empty() ) {
 							// TODO: CharSet pattern, animation type
-							drawChar(g, state.charSet(), state.charSetPos()
+							drawChar(g, charSetHandle( evID, state.charSet() ), state.charSetPos()
 							, state.talkDir(), rpg2k::CharSet::Pat::MIDDLE
 							, CHIP_SIZE*itVec + baseVec - CHAR_SET_OFFSET + ob.correction() );
 						} else {
@@ -319,11 +400,11 @@ void GameMap::render(kuto::Graphics2D& g) const
 							, 10000 + state.charSetPos() );
 						}
 					} else {
-						EventState const& state = cache_.lsd->eventState(x->second);
+						EventState const& state = cache_.lsd->eventState(evID);
 						kuto::Vector2 const itVec( float(it.x), float(it.y) );
 
-						if( state.exists(73) && !state[73].to_string().empty() ) {
-							drawChar(g, state.charSet(), state.charSetPos()
+						if( state.exists(EventState::CHAR_SET) && !state.charSet().empty() ) {
+							drawChar(g, charSetHandle( evID, state.charSet() ), state.charSetPos()
 							, state.talkDir(), rpg2k::CharSet::Pat::MIDDLE
 							, CHIP_SIZE*itVec + baseVec - CHAR_SET_OFFSET + partyObj_.correction() );
 						}
@@ -332,19 +413,62 @@ void GameMap::render(kuto::Graphics2D& g) const
 			}
 		}
 		// above chips
+		drawChipQuads(g, chipSetTex
+		, rowBegin + chipCache_.rows[it.y*2 + 1], rowBegin + chipCache_.rows[it.y*2 + 2]);
+	}
+}
+
+void GameMap::bakeChipLayers(kuto::Point2 const& baseP) const
+{
+	MapUnit const& lmu = *cache_.lmu;
+	kuto::Point2 const mapS( lmu.width(), lmu.height() );
+	kuto::Vector2 const baseVec(0.f, 0.f);
+
+	chipCache_.quads.clear();
+	chipCache_.rows.clear();
+	chipCache_.chipSet = field_.game().texPool().handle(
+		GameTexturePool::ChipSet, ChipSet( cache_.project->chipSet() ).chipSet() );
+
+	kuto::Point2 it;
+	for(it.y = 0; it.y < CHIP_NUM.y; it.y++) {
+		std::bitset<32> aboveLw, aboveUp;
+		boost::array<unsigned, 32> lw, up;
+
+		// below chips
+		chipCache_.rows.push_back( chipCache_.quads.size() );
 		for(it.x = 0; it.x < CHIP_NUM.x; it.x++) {
+			kuto::Point2 const cur = (baseP + it) % mapS;
+			up[it.x] = lmu.chipIDUp(cur.x, cur.y);
+			lw[it.x] = lmu.chipIDLw(cur.x, cur.y);
+			aboveUp[it.x] = isAbove(up[it.x]);
+			aboveLw[it.x] = isAbove(lw[it.x]);
+
 			kuto::Vector2 const itVec( float(it.x), float(it.y) );
-			if( aboveLw[it.x] ) { drawChip( g, chipSetTex, CHIP_SIZE*itVec + baseVec, lw[it.x] ); }
-			if( aboveUp[it.x] ) { drawChip( g, chipSetTex, CHIP_SIZE*itVec + baseVec, up[it.x] ); }
+			if( !aboveLw[it.x] ) { bakeChip(chipCache_.quads, CHIP_SIZE*itVec + baseVec, lw[it.x]); }
+			if( !aboveUp[it.x] ) { bakeChip(chipCache_.quads, CHIP_SIZE*itVec + baseVec, up[it.x]); }
+		}
+		// above chips
+		chipCache_.rows.push_back( chipCache_.quads.size() );
+		for(it.x = 0; it.x < CHIP_NUM.x; it.x++) {
+			kuto::Vector2 const itVec( float(it.x), float(it.y) );
+			if( aboveLw[it.x] ) { bakeChip( chipCache_.quads, CHIP_SIZE*itVec + baseVec, lw[it.x] ); }
+			if( aboveUp[it.x] ) { bakeChip( chipCache_.quads, CHIP_SIZE*itVec + baseVec, up[it.x] ); }
 		}
 	}
+	chipCache_.rows.push_back( chipCache_.quads.size() );
+
+	chipCache_.base = baseP;
+	chipCache_.lmu = &lmu;
+	chipCache_.mapID = lmu.id();
+	chipCache_.chipSetID = cache_.project->chipSetID();
+	chipCache_.replaceRevision = cache_.lsd->replaceRevision();
+	chipCache_.valid = true;
 }
 
 int GameMap::chipFlag(int x, int y, bool upper) const
 {
-	rpg2k::structure::Array1D& chipSet = cache_.project->chipSet();
 	int chipId = upper? cache_.lmu->chipIDUp(x, y) : cache_.lmu->chipIDLw(x, y);
-	return upper? chipSet[5].toBinary()[chipId] : chipSet[4].toBinary()[chipId];
+	return ChipSet( cache_.project->chipSet() ).flag(chipId, upper);
 }
 
 bool GameMap::isCounter(int x, int y) const
@@ -400,8 +524,8 @@ void GameMap::scrollBack(float speed)
 
 bool GameMap::canPass(unsigned evID, rpg2k::EventDir::Type dir) const
 {
-	EventState& state = objects_[evID]->state();
-	state[21] = state[22] = (int) dir;
+	EventState& state = rpg2k::isEvent(evID)? objects_[evID]->state() : cache_.lsd->eventState(evID);
+	state.setDir(dir);
 
 	kuto::Point2 const cur( state.x(), state.y() );
 	kuto::Point2 nxt = cur + directionAdd(dir);
@@ -419,26 +543,19 @@ bool GameMap::canPass(unsigned evID, rpg2k::EventDir::Type dir) const
 
 	return( canPassMap(dir, cur, nxt) && canPassEvent(evID, dir, cur, nxt) );
 }
-void GameMap::move(unsigned const evID, kuto::Point2 const dst)
+void GameMap::move(unsigned evID, kuto::Point2 const dst)
 {
-	EventState& state = objects_[evID]->state();
-	kuto::Point2 const src( state.x(), state.y() );
+	if(evID == rpg2k::ID_THIS) evID = cache_.lsd->currentEventID();
+	EventState& state = eventState(evID);
 
-	unsigned pr;
-	if( !rpg2k::isEvent(evID) ) pr = rpg2k::EventPriority::CHAR;
-	else pr = page(evID)[34].to<int>();
-	// remove previous place
-	std::multimap<unsigned, unsigned>::iterator it = eventMap_[pr][src.y].find(src.x);
-	while(it->second != evID) ++it;
-	eventMap_[pr][src.y].erase(it);
-	// reset next place
-	eventMap_[pr][dst.y].insert( std::make_pair(dst.x, evID) );
-	state[12] = dst.x; state[13] = dst.y;
+	EventIndexEntry const& entry = eventEntries_[ eventSlot(evID) ];
+	if(entry.active) setEventIndex(evID, entry.priority, dst);
+	state.setPosition(dst.x, dst.y);
 }
 bool GameMap::move(unsigned const evID, rpg2k::EventDir::Type const dir)
 {
-	EventState& state = objects_[evID]->state();
-	state[21] = state[22] = (int) dir;
+	EventState& state = eventState(evID);
+	state.setDir(dir);
 
 	kuto::Point2 const cur( state.x(), state.y() );
 	kuto::Point2 nxt = cur + directionAdd(dir);
@@ -491,21 +608,16 @@ bool GameMap::canPassEvent(unsigned const evID, rpg2k::EventDir::Type const dir
 {
 // priority
 	unsigned pr;
-	if( rpg2k::isEvent(evID) ) { pr = page(evID)[34].to<int>(); }
+	if( rpg2k::isEvent(evID) ) { pr = EventPage( page(evID) ).priority(); }
 	else { pr = rpg2k::EventPriority::CHAR; }
 // char
-	if( (pr == rpg2k::EventPriority::CHAR) && eventExists(eventMap_[pr], nxt) ) {
+	if( (pr == rpg2k::EventPriority::CHAR) && eventExists(pr, nxt) ) {
 		return false;
 	}
 // non piled event
 	if( rpg2k::isEvent(evID) )
-	for(int i = rpg2k::EventPriority::BEGIN; i < rpg2k::EventPriority::END; i++) {
-		for(
-			x_it it = eventMap_[i][nxt.y].find(nxt.x);
-			( it != eventMap_[i][nxt.y].end() ) && ( it->first == unsigned(nxt.x) ); ++it
-		) {
-			if( page(it->second)[35].to<bool>() ) return false;
-		}
+	for(int s = eventAt(nxt); s != NO_EVENT; s = eventEntries_[s].next) {
+		if( EventPage( page(eventEntries_[s].evID) ).noPile() ) return false;
 	}
 
 	return true;
@@ -515,65 +627,68 @@ bool GameMap::canPassEvent(unsigned const evID, rpg2k::EventDir::Type const dir
 {
 // priority
 	unsigned pr;
-	if( rpg2k::isEvent(evID) ) { pr = page(evID)[34].to<int>(); }
+	if( rpg2k::isEvent(evID) ) { pr = EventPage( page(evID) ).priority(); }
 	else { pr = rpg2k::EventPriority::CHAR; }
 // char
 	if(pr == rpg2k::EventPriority::CHAR) {
-		std::multimap<unsigned, unsigned> target = eventMap_[rpg2k::EventPriority::CHAR][nxt.y];
-		if(collision) for(
-			x_it it = target.find(nxt.x);
-			( it != target.end() ) && ( it->first == unsigned(nxt.x) ); ++it
-		) {
-			Array1D const& page = this->page(it->second);
+		if(collision) for(int s = eventAt(nxt); s != NO_EVENT; s = eventEntries_[s].next) {
+			unsigned const target = eventEntries_[s].evID;
+			if(eventEntries_[s].priority != rpg2k::EventPriority::CHAR) continue;
+
+			EventPage const page( this->page(target) );
 			if(
-				(it->second == rpg2k::ID_PARTY) &&
-				( page[33].to<int>() == rpg2k::EventStart::EVENT_TOUCH )
+				(target == rpg2k::ID_PARTY) &&
+				( page.startType() == rpg2k::EventStart::EVENT_TOUCH )
 			) { touchFromEvent_.push(evID); }
 			else if(
 				(evID == rpg2k::ID_PARTY) &&
-				( page[33].to<int>() == rpg2k::EventStart::PARTY_TOUCH )
-			) { touchFromParty_.push(it->second); }
+				( page.startType() == rpg2k::EventStart::PARTY_TOUCH )
+			) { touchFromParty_.push(target); }
 		}
 
-		if( target.find(nxt.x) != target.end() ) { return false; }
+		if( eventExists(rpg2k::EventPriority::CHAR, nxt) ) { return false; }
 	} else if( collision && (evID == rpg2k::ID_PARTY) ) {
-		#define PP_check(PRIORITY) \
-			for( \
-				x_it it = eventMap_[PRIORITY][nxt.y].find(nxt.x); \
-				( it != eventMap_[PRIORITY][nxt.y].end() ) && ( it->first == unsigned(nxt.x) ); ++it \
-			) { \
-				Array1D const& page = this->page(it->second); \
-				if( \
-					eventExists(eventMap_[PRIORITY], nxt) && \
-					( page[33].to<int>() == rpg2k::EventStart::PARTY_TOUCH ) \
-				) { touchFromParty_.push(it->second); } \
+		for(int s = eventAt(nxt); s != NO_EVENT; s = eventEntries_[s].next) {
+			unsigned const target = eventEntries_[s].evID;
+			if(eventEntries_[s].priority == rpg2k::EventPriority::CHAR) continue;
+
+			if( EventPage( this->page(target) ).startType() == rpg2k::EventStart::PARTY_TOUCH ) {
+				touchFromParty_.push(target);
 			}
-		PP_check(rpg2k::EventPriority::BELOW)
-		PP_check(rpg2k::EventPriority::ABOVE)
-		#undef PP_check
+		}
 	}
 // non piled event
 	if( rpg2k::isEvent(evID) ) {
-		for(int i = rpg2k::EventPriority::BEGIN; i < rpg2k::EventPriority::END; i++) {
-			for(
-				x_it it = eventMap_[i][nxt.y].find(nxt.x);
-				( it != eventMap_[i][nxt.y].end() ) && ( it->first == unsigned(nxt.x) ); ++it
-			) { if( page(it->second)[35].to<bool>() ) return false; }
+		for(int s = eventAt(nxt); s != NO_EVENT; s = eventEntries_[s].next) {
+			if( EventPage( page(eventEntries_[s].evID) ).noPile() ) return false;
 		}
 	}
 
 	return true;
 }
 
+GameTexturePool::Handle GameMap::charSetHandle(unsigned const evID, rpg2k::RPG2kString const& name) const
+{
+	CharSetHandle& cache = charSets_[ eventSlot(evID) ];
+	if( !cache.valid || (cache.name != name) ) {
+		cache.name = name;
+		cache.handle = field_.game().texPool().handle(GameTexturePool::CharSet, name);
+		cache.valid = true;
+	}
+	return cache.handle;
+}
 void GameMap::drawChar(kuto::Graphics2D& g
-, rpg2k::RPG2kString const& name
+, GameTexturePool::Handle const charSet
 , unsigned const pos
 , rpg2k::CharSet::Dir::Type const dir
 , rpg2k::CharSet::Pat::Type const pat
 , kuto::Vector2 const& dstP) const
 {
-	kuto::Texture const& tex = field_.game().texPool().get(
-		GameTexturePool::CharSet, name.toSystem() );
+	// the char set is loaded on the loader thread, the event isn't drawn until it's ready
+	kuto::Texture const* const texP = field_.game().texPool().getIfReady(charSet);
+	if(texP == NULL) return;
+
+	kuto::Texture const& tex = *texP;
 	kuto::Vector2 const srcP(
 		float( (pos % 4) * rpg2k::CharSet::Pat::END + pat ),
 		float( (pos / 4) * rpg2k::CharSet::Dir::END + dir ) );
@@ -586,8 +701,33 @@ void GameMap::drawChar(kuto::Graphics2D& g
 void GameMap::drawChip(kuto::Graphics2D& g
 , kuto::Texture const& src, kuto::Vector2 const& dstP, unsigned const chipID) const
 {
-	SaveData& lsd = field_.project().getLSD();
+	ChipQuads quads;
+	bakeChip(quads, dstP, chipID);
+	drawChipQuads( g, src, quads.begin(), quads.end() );
+}
+void GameMap::drawChipQuads(kuto::Graphics2D& g, kuto::Texture const& src
+, ChipQuads::const_iterator const begin, ChipQuads::const_iterator const end) const
+{
+	unsigned const animeA_B = counter_ % 12 / 4;
+	kuto_assert( rpg2k::within(animeA_B, 3u) );
+	kuto::Vector2 const animeOffset[] = {
+		kuto::Vector2(0.f, 0.f),
+		kuto::Vector2(CHIP_SIZE.x * animeA_B, 0.f),
+		kuto::Vector2(0.f, CHIP_SIZE.y * (counter_ % 12 / 3) ),
+	};
+
+	kuto::Vector2 const scale( src.width(), src.height() );
+	const kuto::Color color(1.f, 1.f, 1.f, 1.f);
+	for(ChipQuads::const_iterator it = begin; it != end; ++it) {
+		kuto::Vector2 const srcP = it->src + animeOffset[it->anime];
+		g.drawTexture(src, it->dst, it->size, color, srcP / scale, (srcP + it->size) / scale);
+	}
+}
+void GameMap::bakeChip(ChipQuads& dst, kuto::Vector2 const& dstP, unsigned const chipID) const
+{
+	SaveData& lsd = *cache_.lsd;
 	kuto::Vector2 srcP;
+	ChipQuad::Anime anime = ChipQuad::ANIME_NONE;
 
 	if(chipID == 10000) { return; // skip unvisible upper chip
 	} else if( rpg2k::within(chipID, 3000u) ) {
@@ -595,18 +735,18 @@ void GameMap::drawChip(kuto::Graphics2D& g
 		// rpg2k_assert( rpg2k::within( chipID % 1000 / 50, 0x10 ) );
 		// rpg2k_assert( rpg2k::within( chipID % 1000 % 50, 0x2f ) );
 
-		drawBlockA_B( g, src, dstP
-		, chipID / 1000, chipID % 1000 / 50,  chipID % 1000 % 50, counter_ % 12 / 4);
+		bakeBlockA_B( dst, dstP, chipID / 1000, chipID % 1000 / 50,  chipID % 1000 % 50 );
 		return;
 	} else if( rpg2k::within(3000u, chipID, 4000u) ) {
 		// rpg2k_assert( ( (chipID-3000)%50 ) == 28 );
 
-		srcP.set( (chipID-3000)/50+3, 4 + counter_ % 12 / 3 );
+		srcP.set( (chipID-3000)/50+3, 4 );
+		anime = ChipQuad::ANIME_BLOCK_C;
 	} else if( rpg2k::within(4000u, chipID, 5000u) ) {
 		// rpg2k_assert( rpg2k::within( (chipID-4000) / 50, 12 ) );
 		// rpg2k_assert( rpg2k::within( (chipID-4000) % 50, 0x2f ) );
 
-		drawBlockD( g, src, dstP, (chipID-4000) / 50, (chipID-4000) % 50 );
+		bakeBlockD( dst, dstP, (chipID-4000) / 50, (chipID-4000) % 50 );
 		return;
 	} else if( rpg2k::within(5000u, chipID, 5144u) ) {
 		int num = lsd.replace(rpg2k::ChipSet::LOWER, chipID -  5000);
@@ -620,9 +760,8 @@ void GameMap::drawChip(kuto::Graphics2D& g
 			float( (num/6) + (num<48? 8 : -8) ) );
 	} else rpg2k_assert(false);
 
-	kuto::Vector2 const scale( src.width(), src.height() );
-	const kuto::Color color(1.f, 1.f, 1.f, 1.f);
-	g.drawTexture(src, dstP, CHIP_SIZE, color, srcP * CHIP_SIZE / scale, (srcP+1.f) * CHIP_SIZE / scale);
+	ChipQuad const q = { dstP, srcP * CHIP_SIZE, CHIP_SIZE.x, anime };
+	dst.push_back(q);
 }
 // SEG[0] = (0,0), SEG[1] = (8,0),
 // SEG[3] = (0,8), SEG[2] = (8,8)
@@ -633,15 +772,10 @@ static kuto::Vector2 const SEG_P[4] =
 	kuto::Vector2(8.f, 8.f),
 	kuto::Vector2(0.f, 8.f),
 };
-void GameMap::drawBlockA_B(kuto::Graphics2D& g
-, kuto::Texture const& src, kuto::Vector2 const& dstP
-, unsigned const x, unsigned const y, unsigned const z, unsigned const anime) const
+void GameMap::bakeBlockA_B(ChipQuads& dst, kuto::Vector2 const& dstP
+, unsigned const x, unsigned const y, unsigned const z) const
 {
-	kuto_assert( rpg2k::within(anime, 3u) );
-
 	enum Pattern { A = 0, B = 1, C = 2, D = 3, N = 4, };
-	const kuto::Color color(1.f, 1.f, 1.f, 1.f);
-	kuto::Vector2 const scale( src.width(), src.height() );
 // Ocean
 	{
 		Pattern ocean[4];
@@ -653,11 +787,12 @@ void GameMap::drawBlockA_B(kuto::Graphics2D& g
 			kuto::Vector2(0.f, 0.f), kuto::Vector2(8.f, 0.f),
 			kuto::Vector2(0.f, 8.f), kuto::Vector2(8.f, 8.f),
 		};
-		kuto::Vector2 const oceanP = CHIP_SIZE * kuto::Vector2(anime, 4);
+		kuto::Vector2 const oceanP = CHIP_SIZE * kuto::Vector2(0, 4);
 		for(int i = 0; i < 4; i++) {
-			g.drawTexture(src, dstP + OCN_SEG_P[i], CHIP_SIZE * 0.5f, color
-			, (oceanP + kuto::Vector2(0.f, 16.f) * ocean[i] + OCN_SEG_P[i]) / scale
-			, (oceanP + kuto::Vector2(0.f, 16.f) * ocean[i] + OCN_SEG_P[i] + CHIP_SIZE * 0.5f) / scale );
+			ChipQuad const q = { dstP + OCN_SEG_P[i]
+			, oceanP + kuto::Vector2(0.f, 16.f) * ocean[i] + OCN_SEG_P[i]
+			, CHIP_SIZE.x * 0.5f, ChipQuad::ANIME_BLOCK_A_B };
+			dst.push_back(q);
 		}
 	}
 // Coast
@@ -718,17 +853,18 @@ void GameMap::drawBlockA_B(kuto::Graphics2D& g
 				break;
 			default: rpg2k_assert(false); break;
 		}
-		kuto::Vector2 const coastP = CHIP_SIZE * kuto::Vector2( ( (x==1)? 3 : 0 ) + anime, 0.f );
+		kuto::Vector2 const coastP = CHIP_SIZE * kuto::Vector2( (x==1)? 3 : 0, 0.f );
 		for(int i = 0; i < 4; i++) {
 			if( coast[i] == N ) continue;
 
-			g.drawTexture(src, dstP + SEG_P[i], CHIP_SIZE * 0.5f, color
-			, (coastP + kuto::Vector2(0.f, 16.f) * coast[i] + SEG_P[i]) / scale
-			, (coastP + kuto::Vector2(0.f, 16.f) * coast[i] + SEG_P[i] + CHIP_SIZE * 0.5f) / scale );
+			ChipQuad const q = { dstP + SEG_P[i]
+			, coastP + kuto::Vector2(0.f, 16.f) * coast[i] + SEG_P[i]
+			, CHIP_SIZE.x * 0.5f, ChipQuad::ANIME_BLOCK_A_B };
+			dst.push_back(q);
 		}
 	}
 }
-void GameMap::drawBlockD(kuto::Graphics2D& g, kuto::Texture const& src
+void GameMap::bakeBlockD(ChipQuads& dst
 , kuto::Vector2 const& dstP, unsigned const x, unsigned const y) const
 {
 	enum Pattern {
@@ -795,12 +931,10 @@ void GameMap::drawBlockD(kuto::Graphics2D& g, kuto::Texture const& src
 		kuto::Vector2( 0.f, 32.f), kuto::Vector2(16.f, 32.f), kuto::Vector2(32.f, 32.f),
 		kuto::Vector2( 0.f, 48.f), kuto::Vector2(16.f, 48.f), kuto::Vector2(32.f, 48.f),
 	};
-	kuto::Color const color(1.f, 1.f, 1.f, 1.f);
-	kuto::Vector2 const scale( src.width(), src.height() );
 	for(int i = 0; i < 4; i++) {
-		g.drawTexture(src, dstP+SEG_P[i], CHIP_SIZE/2, color
-		, (baseP + PAT_P[ pat[i] ] + SEG_P[i]) / scale
-		, (baseP + PAT_P[ pat[i] ] + SEG_P[i] + CHIP_SIZE * 0.5f) / scale );
+		ChipQuad const q = { dstP+SEG_P[i], baseP + PAT_P[ pat[i] ] + SEG_P[i]
+		, CHIP_SIZE.x * 0.5f, ChipQuad::ANIME_NONE };
+		dst.push_back(q);
 	}
 }
 
@@ -10,6 +10,8 @@
 #include <kuto/kuto_point2.h>
 #include <kuto/kuto_texture.h>
 
+#include "game_texture_pool.h"
+
 #include <rpg2k/Define.hpp>
 
 #include <stack>
@@ -96,15 +98,44 @@ protected:
 	bool canPassEvent(unsigned evID, rpg2k::EventDir::Type dir
 	, kuto::Point2 const& cur, kuto::Point2 const& nxt, bool collision);
 
+	/// one chip segment. src is the chipset pixel position without animation
+	struct ChipQuad
+	{
+		enum Anime { ANIME_NONE, ANIME_BLOCK_A_B, ANIME_BLOCK_C, };
+
+		kuto::Vector2 dst;
+		kuto::Vector2 src;
+		float size;
+		Anime anime;
+	};
+	typedef std::vector<ChipQuad> ChipQuads;
+
 	void drawChip(kuto::Graphics2D& g
 	, kuto::Texture const& src, kuto::Vector2 const& dstP, unsigned chipID) const;
-	void drawBlockD(kuto::Graphics2D& g
-	, kuto::Texture const& src, kuto::Vector2 const& dstP, unsigned x, unsigned y) const;
-	void drawBlockA_B(kuto::Graphics2D& g, kuto::Texture const& src
-	, kuto::Vector2 const& dstP, unsigned x, unsigned y, unsigned z, unsigned anime) const;
-
+	void drawChipQuads(kuto::Graphics2D& g, kuto::Texture const& src
+	, ChipQuads::const_iterator begin, ChipQuads::const_iterator end) const;
+	void bakeChip(ChipQuads& dst, kuto::Vector2 const& dstP, unsigned chipID) const;
+	void bakeBlockD(ChipQuads& dst
+	, kuto::Vector2 const& dstP, unsigned x, unsigned y) const;
+	void bakeBlockA_B(ChipQuads& dst
+	, kuto::Vector2 const& dstP, unsigned x, unsigned y, unsigned z) const;
+	void bakeChipLayers(kuto::Point2 const& baseP) const;
+
+	rpg2k::structure::EventState& eventState(unsigned evID);
+
+	enum { NO_EVENT = -1, };
+	void resetEventIndex();
+	void updatePages();
+	void updatePage(unsigned evID);
+	void setEventIndex(unsigned evID, unsigned priority, kuto::Point2 const& pos);
+	void removeEventIndex(unsigned evID);
+	unsigned eventSlot(unsigned evID) const;
+	int eventAt(kuto::Point2 const& pos) const { return eventCells_[cache_.mapSize.x * pos.y + pos.x]; }
+	bool eventExists(unsigned priority, kuto::Point2 const& pos) const;
+
+	GameTexturePool::Handle charSetHandle(unsigned evID, rpg2k::RPG2kString const& name) const;
 	void drawChar(kuto::Graphics2D& g
-	, rpg2k::RPG2kString const& name, unsigned pos
+	, GameTexturePool::Handle charSet, unsigned pos
 	, rpg2k::CharSet::Dir::Type, rpg2k::CharSet::Pat::Type
 	, kuto::Vector2 const& dstP
 	) const;
@@ -126,8 +157,28 @@ private:
 	unsigned counter_;
 
 	std::vector<GameMapObject*> objects_;
-	std::vector< std::vector< std::multimap<unsigned, unsigned> > > eventMap_; // (priority, y, x)
 	std::vector<unsigned> pageNo_;
+
+	/// spatial event index kept across frames. entries of one cell are linked in evID order
+	struct EventIndexEntry
+	{
+		unsigned evID;
+		unsigned priority;
+		kuto::Point2 pos;
+		int next;
+		bool active;
+	};
+	std::vector<EventIndexEntry> eventEntries_; // slot: evID of map event, then party and vehicles
+	std::vector<int> eventCells_; // first slot of each cell (y * width + x)
+	unsigned conditionRevision_; // SaveData::conditionRevision() when pages were evaluated
+	struct CharSetHandle
+	{
+		rpg2k::RPG2kString name;
+		GameTexturePool::Handle handle;
+		bool valid;
+	};
+	mutable std::vector<CharSetHandle> charSets_; // resolved charset of each event slot
+	bool pageValid_;
 	std::stack<unsigned> touchFromEvent_, touchFromParty_, keyEnter_;
 
 	bool justMoved_;
@@ -147,7 +198,21 @@ private:
 		rpg2k::structure::EventState* party;
 		kuto::Point2 mapSize;
 		int scrollFlag;
-		std::string panorama;
+		rpg2k::RPG2kString panorama;
 	} cache_;
 	void updateCache();
+
+	/// visible lower/upper chips, rebuilt when scroll origin, map, chipset or replace table changes
+	mutable struct
+	{
+		bool valid;
+		kuto::Point2 base;
+		rpg2k::model::MapUnit const* lmu;
+		unsigned mapID;
+		unsigned chipSetID;
+		unsigned replaceRevision;
+		GameTexturePool::Handle chipSet;
+		ChipQuads quads;
+		std::vector<unsigned> rows; // row * 2: below begin, row * 2 + 1: above begin
+	} chipCache_;
 };
@@ -126,7 +126,7 @@ void GameMapObject::update()
 		case 0: // none
 			return;
 		case 1: // random
-			move( rpg2k::EventDir::Type( ( kuto::random(4) + 1 ) * 2 ) );
+			move( rpg2k::EventDir::Type( ( kuto::random(4, kuto::RANDOM_MAP) + 1 ) * 2 ) );
 			break;
 		case 2: // vertical
 			switch( state_->eventDir() ) {
@@ -134,13 +134,13 @@ void GameMapObject::update()
 				case rpg2k::CharSet::Dir::DOWN:
 					break;
 				default:
-					(*state_)[21] = int(rpg2k::CharSet::Dir::UP);
+					state()[21] = int(rpg2k::CharSet::Dir::UP);
 					break;
 			}
 			if( !move( rpg2k::toEventDir( state_->eventDir() ) ) ) {
 				switch( state_->eventDir() ) {
-					case rpg2k::CharSet::Dir::UP: (*state_)[21] = int(rpg2k::CharSet::Dir::DOWN);
-					case rpg2k::CharSet::Dir::DOWN: (*state_)[21] = int(rpg2k::CharSet::Dir::UP);
+					case rpg2k::CharSet::Dir::UP: state()[21] = int(rpg2k::CharSet::Dir::DOWN);
+					case rpg2k::CharSet::Dir::DOWN: state()[21] = int(rpg2k::CharSet::Dir::UP);
 					default: kuto_assert(false); break;
 				}
 			}
@@ -151,13 +151,13 @@ void GameMapObject::update()
 				case rpg2k::CharSet::Dir::RIGHT:
 					break;
 				default:
-					(*state_)[21] = int(rpg2k::CharSet::Dir::RIGHT);
+					state()[21] = int(rpg2k::CharSet::Dir::RIGHT);
 					break;
 			}
 			if( !move( rpg2k::toEventDir( state_->eventDir() ) ) ) {
 				switch( state_->eventDir() ) {
-					case rpg2k::CharSet::Dir::LEFT: (*state_)[21] = int(rpg2k::CharSet::Dir::RIGHT);
-					case rpg2k::CharSet::Dir::RIGHT: (*state_)[21] = int(rpg2k::CharSet::Dir::LEFT);
+					case rpg2k::CharSet::Dir::LEFT: state()[21] = int(rpg2k::CharSet::Dir::RIGHT);
+					case rpg2k::CharSet::Dir::RIGHT: state()[21] = int(rpg2k::CharSet::Dir::LEFT);
 					default: kuto_assert(false); break;
 				}
 			}
@@ -185,11 +185,14 @@ void GameMapObject::update()
 		}
 	}
 
-	(*state_)[52] = (*state_)[52].to<int>() + 1; // add counter
+	EventState& st = state();
+	st[52] = st[52].to<int>() + 1; // add counter
 }
 
 rpg2k::structure::EventState& GameMapObject::state()
 {
+	// state_ points into the live save data, saved slots sharing it get their copy first
+	owner_.field().project().getLSD().detach();
 	return *state_;
 }
 rpg2k::structure::Array1D const& GameMapObject::page() const
@@ -82,7 +82,11 @@ void GamePictureManager::Picture::render(kuto::Graphics2D& g) const
 		sat = pict[44].to<double>();
 	}
 
-	kuto::Texture& tex = field_.game().texPool().picture( pict[1].to_string().toSystem(), pict[9].to<bool>() );
+	// the picture is loaded on the loader thread, it isn't shown until it's ready
+	kuto::Texture* const texP = field_.game().texPool().pictureIfReady( pict[1].to_string().toSystem(), pict[9].to<bool>() );
+	if(texP == NULL) return;
+
+	kuto::Texture& tex = *texP;
 	kuto::Vector2 texS( tex.orgWidth(), tex.orgHeight() );
 	kuto::Vector2 pictS = texS * scale / 100.f;
 	kuto::ColorHSV colorHSV = (color / 100.f).hsv();
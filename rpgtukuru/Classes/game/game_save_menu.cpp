@@ -6,6 +6,7 @@
 
 #include <kuto/kuto_render_manager.h>
 #include <kuto/kuto_file.h>
+#include <kuto/kuto_random.h>
 #include "game_save_menu.h"
 #include <rpg2k/Project.hpp>
 #include "game_field.h"
@@ -31,6 +32,7 @@ void GameSaveMenu::update()
 	switch (state_) {
 	case kStateTop:
 		if (menu_->selected()) {
+			field_.project().getLSD().setRandomState(kuto::randomState());
 			field_.project().saveLSD(menu_->selectIndex());
 			/*
 			GameSaveData saveData;
@@ -33,15 +33,14 @@ GameSaveLoadMenu::GameSaveLoadMenu(Game& g, bool modeSave)
 	// readHeaders();
 	for (uint i = 0; i < rpg2k::SAVE_DATA_MAX; i++) {
 		std::ostringstream oss;
-		rpg2k::model::SaveData& lsd = project_.getLSD(i + 1);
+		rpg2k::model::SaveDataPreview const& preview = project_.getLSDPreview(i + 1);
 		oss << "Save" << std::setw(2) << (i + 1) << " ";
-		if ( lsd.exists() ) {
-			rpg2k::structure::Array1D& preview = lsd[100];
+		if ( preview.exists() ) {
 			oss << preview[11].to_string().toSystem() << " " << ldb.vocabulary(128).toSystem() << std::setw(2) << preview[12].to<int>();
 		} else {
 			oss << "Empty";
 		}
-		topMenu_.addLine(oss.str(), modeSave_ || lsd.exists());
+		topMenu_.addLine(oss.str(), modeSave_ || preview.exists());
 	}
 
 	descriptionWindow_.pauseUpdate();
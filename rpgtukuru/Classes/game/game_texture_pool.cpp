@@ -33,7 +33,55 @@ kuto::Texture& GameTexturePool::get(GameTexturePool::Type t, rpg2k::SystemString
 	Pool::iterator it = pool_[t].find(name);
 	if( it == pool_[t].end() ) {
 		return *pool_[t].insert( name, load(t, name, TRANS[t]) ).first->second;
-	} else return *it->second;
+	} else {
+		it->second->wait();
+		return *it->second;
+	}
+}
+void GameTexturePool::prefetch(GameTexturePool::Type t, rpg2k::RPG2kString const& name)
+{
+	kuto_assert(t != Picture);
+	kuto_assert(t < TYPE_END);
+
+	rpg2k::SystemString const sysName = name.toSystem();
+	if( pool_[t].find(sysName) == pool_[t].end() ) {
+		pool_[t].insert( sysName, load(t, sysName, TRANS[t], true) );
+	}
+}
+kuto::Texture& GameTexturePool::get(GameTexturePool::Handle const h)
+{
+	kuto_assert( h < handles_.size() );
+
+	HandleEntry& entry = handles_[h];
+	if(entry.texture == NULL) entry.texture = &get(entry.type, entry.name);
+	else entry.texture->wait();
+	return *entry.texture;
+}
+kuto::Texture* GameTexturePool::getIfReady(GameTexturePool::Handle const h)
+{
+	kuto_assert( h < handles_.size() );
+
+	HandleEntry& entry = handles_[h];
+	if(entry.texture == NULL) {
+		Pool& pool = pool_[entry.type];
+		Pool::iterator it = pool.find(entry.name);
+		if( it == pool.end() ) {
+			it = pool.insert( entry.name, load(entry.type, entry.name, TRANS[entry.type], true) ).first;
+		}
+		entry.texture = it->second;
+	}
+	return entry.texture->isReady()? entry.texture : NULL;
+}
+GameTexturePool::Handle GameTexturePool::handle(GameTexturePool::Type t, rpg2k::RPG2kString const& name)
+{
+	kuto_assert(t < TYPE_END);
+
+	HandleTable::const_iterator it = handleTable_[t].find(name);
+	if( it != handleTable_[t].end() ) return it->second;
+
+	HandleEntry const entry = { t, name.toSystem(), NULL };
+	handles_.push_back(entry);
+	return handleTable_[t][name] = handles_.size() - 1;
 }
 kuto::Texture& GameTexturePool::picture(rpg2k::SystemString const& name, bool const trans)
 {
@@ -41,14 +89,26 @@ kuto::Texture& GameTexturePool::picture(rpg2k::SystemString const& name, bool co
 	if( it == picturePool_[trans].end() ) {
 		return *picturePool_[trans].insert( name
 		, load(GameTexturePool::Picture, name, trans) ).first->second;
-	} else return *it->second;
+	} else {
+		it->second->wait();
+		return *it->second;
+	}
+}
+kuto::Texture* GameTexturePool::pictureIfReady(rpg2k::SystemString const& name, bool const trans)
+{
+	Pool::iterator it = picturePool_[trans].find(name);
+	if( it == picturePool_[trans].end() ) {
+		it = picturePool_[trans].insert( name
+		, load(GameTexturePool::Picture, name, trans, true) ).first;
+	}
+	return it->second->isReady()? it->second : NULL;
 }
 
-std::auto_ptr< kuto::Texture > GameTexturePool::load(GameTexturePool::Type t, std::string const& name, bool const trans) const
+std::auto_ptr< kuto::Texture > GameTexturePool::load(GameTexturePool::Type t, std::string const& name, bool const trans, bool const async) const
 {
 	std::auto_ptr<kuto::Texture> newed(new kuto::Texture);
 	if( !RPG2kUtil::LoadImage(*newed,
-		std::string( project_.gameDir() ).append("/").append(DIR_NAME[t]).append("/").append(name), trans)
+		std::string( project_.gameDir() ).append("/").append(DIR_NAME[t]).append("/").append(name), trans, 0, async)
 	) { kuto_assert(false); }
 	return newed;
 }
@@ -61,4 +121,7 @@ void GameTexturePool::clear()
 	for(kuto::Array<Pool, 2>::iterator it = picturePool_.begin(); it < picturePool_.end(); ++it) {
 		it->clear();
 	}
+	for(std::vector<HandleEntry>::iterator it = handles_.begin(); it < handles_.end(); ++it) {
+		it->texture = NULL;
+	}
 }
@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <kuto/kuto_texture.h>
 #include <kuto/kuto_array.h>
@@ -10,6 +11,7 @@
 #include <boost/array.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/ptr_container/ptr_unordered_map.hpp>
+#include <boost/unordered_map.hpp>
 
 namespace rpg2k { namespace model { class Project; } }
 
@@ -42,18 +44,28 @@ public:
 		#undef PP_enum
 		TYPE_END,
 	};
+	// index of a resolved texture name, stays valid after clear()
+	typedef unsigned Handle;
 
 public:
 	GameTexturePool(rpg2k::model::Project const& p);
 
 	kuto::Texture& get(GameTexturePool::Type t, rpg2k::SystemString const& name);
+	kuto::Texture& get(GameTexturePool::Type t, rpg2k::RPG2kString const& name) { return get( handle(t, name) ); }
+	kuto::Texture& get(Handle h);
+	Handle handle(GameTexturePool::Type t, rpg2k::RPG2kString const& name);
 	kuto::Texture& picture(rpg2k::SystemString const& name, bool const trans);
+	// starts loading without waiting. get() waits for it if it's still loading
+	void prefetch(GameTexturePool::Type t, rpg2k::RPG2kString const& name);
+	// start loading without waiting and return NULL until the texture is ready
+	kuto::Texture* getIfReady(Handle h);
+	kuto::Texture* pictureIfReady(rpg2k::SystemString const& name, bool const trans);
 
 	void clear();
 
 protected:
 	std::auto_ptr< kuto::Texture > load(GameTexturePool::Type t
-	, std::string const& name, bool const trans) const;
+	, std::string const& name, bool const trans, bool const async = false) const;
 
 private:
 	rpg2k::model::Project const& project_;
@@ -62,6 +74,16 @@ private:
 	boost::array<Pool, TYPE_END> pool_;
 	boost::array<Pool, 2> picturePool_;
 
+	struct HandleEntry
+	{
+		GameTexturePool::Type type;
+		rpg2k::SystemString name;
+		kuto::Texture* texture;
+	};
+	std::vector<HandleEntry> handles_;
+	typedef boost::unordered_map<std::string, Handle> HandleTable; // key is RPG2kString
+	boost::array<HandleTable, TYPE_END> handleTable_;
+
 	static boost::array<char const*, TYPE_END> const DIR_NAME;
 	static boost::array<bool, TYPE_END> const TRANS;
 }; // class GameTexturePool
@@ -9,6 +9,7 @@
 
 #include <kuto/kuto_render_manager.h>
 #include <kuto/kuto_graphics2d.h>
+#include <kuto/kuto_utility.h>
 
 #include <rpg2k/Project.hpp>
 
@@ -29,6 +30,14 @@ void GameWindow::setPriority(float value)
 	IRender2D::reset(kuto::Layer::OBJECT_2D, priority_);
 }
 
+void GameWindow::setFontSize(float value)
+{
+	fontSize_ = value;
+	for (uint i = 0; i < messages_.size(); i++) {
+		messages_[i].width = -1.f;
+	}
+}
+
 bool GameWindow::initialize()
 {
 	return isInitializedChildren();
@@ -115,85 +124,160 @@ void GameWindow::setFaceTexture(const std::string& filename, uint position, bool
 	}
 }
 
-void GameWindow::renderTextLine(kuto::Graphics2D& g, int line, int row, int columnMax, int count) const
+namespace
+{
+	/// byte size of the UTF-8 character starting with c
+	int charSize(char const c)
+	{
+		if (c & 0x80) {
+			if (c & 0x40) {
+				return (c & 0x20)? 3 : 2;
+			}
+		}
+		return 1;
+	}
+
+	/// atoi of the "[...]" argument at pos. moves pos past the ']'
+	int escapeParam(std::string const& str, std::string::size_type& pos)
+	{
+		std::string::size_type const end = str.find(']', pos);
+		int const ret = atoi( str.c_str() + kuto::min(pos + 1, str.size()) );	// skip [
+		pos = (end == std::string::npos)? str.size() : end + 1;
+		return ret;
+	}
+} // namespace
+
+GameWindow::MessageInfo::MessageInfo(const std::string& str, int colorType)
+: str(str), colorType(colorType), steps(0), dynamic(false), layoutValid(false), width(-1.f)
 {
-	int strPos = 0;
-	std::string mes;
-	std::string const& srcStr = messages_[line].str;
-	for (std::string::const_iterator i = srcStr.begin(); i < srcStr.end(); ++i) {
-		strPos++;
-		if (count >= 0 && strPos > count) {
+	std::string::size_type pos = 0;
+	while (pos < str.size()) {
+		if (str[pos] != '\\') {
+			if (tokens.empty() || tokens.back().type != MessageToken::kText)
+				tokens.push_back(MessageToken(MessageToken::kText));
+			int const size = kuto::min<int>(charSize(str[pos]), str.size() - pos);
+			tokens.back().text.append(str, pos, size);
+			tokens.back().steps++;
+			pos += size;
+			continue;
+		}
+		if (++pos >= str.size())
+			break;
+		char const c = tolower(str[pos++]);
+		switch (c) {
+		case '\\':
+		case '_':
+			if (tokens.empty() || tokens.back().type != MessageToken::kText)
+				tokens.push_back(MessageToken(MessageToken::kText));
+			tokens.back().text.push_back(c == '_'? ' ' : '\\');
+			tokens.back().steps++;
+			break;
+		case 'c':
+		case 's':
+			escapeParam(str, pos);
+			tokens.push_back(MessageToken(MessageToken::kControl));
+			break;
+		case 'n':
+			tokens.push_back(MessageToken(MessageToken::kName, escapeParam(str, pos)));
+			break;
+		case 'v':
+			tokens.push_back(MessageToken(MessageToken::kVariable, escapeParam(str, pos)));
+			break;
+		case '$':
+			tokens.push_back(MessageToken(MessageToken::kMoney));
+			break;
+		default:	// \! \. \| \> \<
+			tokens.push_back(MessageToken(MessageToken::kControl));
 			break;
 		}
-		if (*i == '\\') {
-			i++;
-			switch ( tolower(*i) ) {
-			case '\\':
-				mes.push_back(*i);
-				break;
-			case 'c':
-				i++;		// skip c
-				i++;		// skip [
-				while (*i != ']') { i++; }
-				break;
-			case 's':
-				i++;		// skip s
-				i++;		// skip [
-				while (*i != ']') { i++; }
-				break;
-			case 'n':
-				i++;		// skip n
-				i++;		// skip [
-				mes += project_.character( atoi( &(*i) ) ).name();
-				while (*i != ']') { i++; }
-				break;
-			case 'v':
-				i++;		// skip v
-				i++;		// skip [
+	}
+	for (uint i = 0; i < tokens.size(); i++) {
+		steps += tokens[i].steps;
+		dynamic |= (tokens[i].type >= MessageToken::kName);
+	}
+}
+
+/**
+ * ゲームデータの値が変わったトークンだけ展開しなおして、レイアウトを返す
+ */
+const GameWindow::MessageInfo& GameWindow::layout(int line) const
+{
+	const MessageInfo& info = messages_[line];
+	if (info.dynamic) {
+		for (uint i = 0; i < info.tokens.size(); i++) {
+			const MessageToken& token = info.tokens[i];
+			switch (token.type) {
+			case MessageToken::kName:
 				{
-					char tempStr[32];
-					sprintf(tempStr, "%d", project_.getLSD().var(atoi( &(*i) )));
-					mes += tempStr;
+					std::string const& name = project_.character(token.param).name();
+					if (!info.layoutValid || token.text != name) {
+						token.text = name;
+						info.layoutValid = false;
+					}
 				}
-				while (*i != ']') { i++; }
 				break;
-			case '$':
+			case MessageToken::kVariable:
+			case MessageToken::kMoney:
 				{
-					char tempStr[32];
-					sprintf(tempStr, "%d", project_.getLSD().money());
-					mes += tempStr;
+					int const value = (token.type == MessageToken::kMoney)? project_.getLSD().money()
+						: project_.getLSD().var(token.param);
+					if (!info.layoutValid || token.value != value) {
+						char tempStr[32];
+						sprintf(tempStr, "%d", value);
+						token.text = tempStr;
+						token.value = value;
+						info.layoutValid = false;
+					}
 				}
 				break;
-			case '!':
-				break;
-			case '.':
-				break;
-			case '|':
-				break;
-			case '>':
-				break;
-			case '<':
-				break;
-			case '_':
-				mes.push_back(' ');
+			default:
 				break;
 			}
-		} else {
-			char const c = *i;
-			mes.push_back(c);
-			if (c & 0x80) {
-				if (c & 0x40) {
-					mes.push_back( *(++i) );
-					if (c & 0x20) {
-						mes.push_back( *(++i) );
-					}
-				}
+		}
+	}
+	if (!info.layoutValid)
+		updateLayout(info);
+	return info;
+}
+
+/**
+ * トークンをつなげて表示文字列とステップごとの終端を作りなおす
+ */
+void GameWindow::updateLayout(const MessageInfo& info) const
+{
+	info.text.clear();
+	info.stepEnd.clear();
+	info.stepEnd.reserve(info.steps);
+	for (uint i = 0; i < info.tokens.size(); i++) {
+		const MessageToken& token = info.tokens[i];
+		if (token.type == MessageToken::kText) {
+			for (std::string::size_type pos = 0; pos < token.text.size(); ) {
+				pos += charSize(token.text[pos]);
+				info.stepEnd.push_back(info.text.size() + kuto::min(pos, token.text.size()));
 			}
+			info.text += token.text;
+		} else {
+			info.text += token.text;
+			info.stepEnd.push_back(info.text.size());
 		}
 	}
+	info.width = -1.f;
+	info.layoutValid = true;
+}
+
+void GameWindow::renderTextLine(kuto::Graphics2D& g, int line, int row, int columnMax, int count) const
+{
+	const MessageInfo& info = layout(line);
+	bool const whole = (count < 0 || count >= (int)info.steps);
+	if (!whole && count <= 0)
+		return;
+	std::string partial;
+	if (!whole)
+		partial.assign(info.text, 0, info.stepEnd[count - 1]);
+	const char* mes = whole? info.text.c_str() : partial.c_str();
 
 	kuto::Color color(1.f, 1.f, 1.f, 1.f);
-	switch (messages_[line].colorType) {
+	switch (info.colorType) {
 	case 1:
 		color.set(0.5f, 0.5f, 0.5f, 1.f);
 		break;
@@ -213,19 +297,28 @@ void GameWindow::renderTextLine(kuto::Graphics2D& g, int line, int row, int colu
 	pos.y += (rowHeight_ + lineSpace_) * row;
 	pos.y += (rowHeight_ - fontSize_) * 0.5f;
 
-	kuto::Vector2 scale = kuto::Font::instance().textSize(mes.c_str(), fontSize_, kuto::Font::NORMAL);
+	float width = 0.f;
+	if (messageAlign_ != kAlignLeft) {	// the whole line is measured once per layout
+		if (!whole) {
+			width = kuto::Font::instance().textSize(mes, fontSize_, kuto::Font::NORMAL).x;
+		} else {
+			if (info.width < 0.f)
+				info.width = kuto::Font::instance().textSize(mes, fontSize_, kuto::Font::NORMAL).x;
+			width = info.width;
+		}
+	}
 	switch (messageAlign_) {
 	case kAlignLeft:
 		pos.x = windowPosition.x + 8.f;
 		break;
 	case kAlignRight:
-		pos.x = windowPosition.x + windowSize.x - scale.x - 8.f;
+		pos.x = windowPosition.x + windowSize.x - width - 8.f;
 		break;
 	case kAlignCenter:
-		pos.x = windowPosition.x + (windowSize.x - scale.x) * 0.5f;
+		pos.x = windowPosition.x + (windowSize.x - width) * 0.5f;
 		break;
 	}
-	g.drawText(mes.c_str(), pos, color, fontSize_, kuto::Font::NORMAL);
+	g.drawText(mes, pos, color, fontSize_, kuto::Font::NORMAL);
 	// g.drawText( mes.c_str(), pos, systemTexture(project_)
 	// , 0, kuto::Font::Type( project_.fontType() ), fontSize_ );
 }
@@ -234,92 +327,12 @@ uint GameWindow::messageLength() const
 {
 	uint length = 0;
 	for (uint line = 0; line < messages_.size(); line++) {
-		length += messageLineLength(line);
+		length += messages_[line].steps;
 	}
 	return length;
 }
 
 uint GameWindow::messageLineLength(int const line) const
 {
-	unsigned length = 0;
-	std::string const& srcStr = messages_[line].str;
-	for (std::string::const_iterator i = srcStr.begin(); i < srcStr.end(); ++i) {
-		length++;
-		char c = *i;
-		if (c & 0x80) {
-			if (c & 0x40) {
-				++i;
-				if (c & 0x20) {
-					++i;
-				}
-			}
-		} else if (*i == '\\') {
-			++i;
-			c = tolower(*i);
-			switch (*i) {
-			case '\\':
-				break;
-			case 'c':
-				length--;
-				++i;
-				while (*i != ']') {
-					++i;
-				}
-				break;
-			case 's':
-				length--;
-				++i;
-				while (*i != ']') {
-					++i;
-				}
-				break;
-			case 'n':
-				length--;
-				++i;
-				length += project_.character(atoi(srcStr.c_str() + (i - srcStr.begin()))).name().size();
-				while (*i != ']') {
-					++i;
-				}
-				break;
-			case 'v':
-				length--;
-				++i;
-				{
-					char tempStr[32];
-					sprintf(tempStr, "%d", project_.getLSD().var(atoi(srcStr.c_str() + (i - srcStr.begin()))));
-					length += strlen(tempStr);
-				}
-				while (*i != ']') {
-					++i;
-				}
-				break;
-			case '$':
-				length--;
-				{
-					char tempStr[32];
-					sprintf(tempStr, "%d", project_.getLSD().money());
-					length += strlen(tempStr);
-				}
-				break;
-			case '!':
-				length--;
-				break;
-			case '.':
-				length--;
-				break;
-			case '|':
-				length--;
-				break;
-			case '>':
-				length--;
-				break;
-			case '<':
-				length--;
-				break;
-			case '_':
-				break;
-			}
-		}
-	}
-	return length;
+	return messages_[line].steps;
 }
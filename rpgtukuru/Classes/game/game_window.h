@@ -12,6 +12,7 @@
 
 #include <string>
 #include <deque>
+#include <vector>
 
 namespace rpg2k { namespace model { class Project; } }
 
@@ -35,12 +36,38 @@ public:
 		kLineStringMax = 25,
 		kLineStringFaceMax = 19,
 	};
+	/// escape-parsed run of a message. game data escapes are re-expanded only when the data changes
+	struct MessageToken {
+		enum Type {
+			kText,			///< literal characters
+			kControl,		///< \\c[] \\s[] \\! ... (no text)
+			kName,			///< \\n[]
+			kVariable,		///< \\v[]
+			kMoney,			///< \\$
+		};
+		Type			type;
+		int				param;		///< character / variable ID
+		mutable int			value;	///< kVariable / kMoney value text was made from
+		mutable std::string	text;	///< expanded text
+		uint			steps;		///< animation steps. 1 a character, 1 for each escape
+
+		MessageToken(Type type, int param = 0) : type(type), param(param), value(0), steps(type == kText? 0 : 1) {}
+	};
 	struct MessageInfo {
 		std::string		str;
 		int				colorType;
 
-		MessageInfo() : colorType(0) {}
-		MessageInfo(const std::string& str, int colorType) : str(str), colorType(colorType) {}
+		std::vector<MessageToken>	tokens;
+		uint						steps;		///< sum of the tokens' steps
+		bool						dynamic;	///< has game data tokens
+		// expanded layout, rebuilt by GameWindow::updateLayout()
+		mutable bool				layoutValid;
+		mutable std::string			text;		///< tokens joined
+		mutable std::vector<uint>	stepEnd;	///< end of each animation step in text
+		mutable float				width;		///< text width, < 0 until measured
+
+		MessageInfo() : colorType(0), steps(0), dynamic(false), layoutValid(false), width(-1.f) {}
+		MessageInfo(const std::string& str, int colorType);
 	};
 	typedef std::deque<MessageInfo> MessageList;
 
@@ -57,6 +84,8 @@ protected:
 	void renderTextLine(kuto::Graphics2D& g, int line, int row, int columnMax, int count) const;
 
 	void addMessageImpl(const std::string& message, int colorType = 0) { messages_.push_back(MessageInfo(message, colorType)); }
+	const MessageInfo& layout(int line) const;
+	void updateLayout(const MessageInfo& info) const;
 
 public:
 	virtual void clearMessages() { messages_.clear(); }
@@ -66,7 +95,7 @@ public:
 	uint messageLineLength(int line) const;
 	void setPosition(const kuto::Vector2& value) { position_ = value; }
 	void setSize(const kuto::Vector2& value) { size_ = value; }
-	void setFontSize(float value) { fontSize_ = value; }
+	void setFontSize(float value);
 	void setMessageAlign(MessageAlign align) { messageAlign_ = align; }
 	void setPriority(float value); // { priority_ = value; }
 	void setShowFrame(bool value) { showFrame_ = value; }
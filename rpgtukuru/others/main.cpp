@@ -5,6 +5,7 @@
  */
 
 #include <cstdlib>
+#include <cstring>
 #include <kuto/kuto_audio_device.h>
 #include <kuto/kuto_graphics_device.h>
 #include <kuto/kuto_memory.h>
@@ -49,9 +50,34 @@ extern "C" int SDL_main(int argc, char* argv[])
 extern "C" int main(int argc, char* argv[])
 #endif
 {
+	// --headless <frames> [--dump <directory>] [--section <name>] renders without a window or GL context
+	// --seed <n> makes the random numbers the same every run
+	int headlessFrames = 0;
+	const char* dumpDirectory = NULL;
+	const char* firstSection = NULL;
+	const char* randomSeed = NULL;
+	for (int i = 1; i + 1 < argc; i++) {
+		if (std::strcmp(argv[i], "--headless") == 0)
+			headlessFrames = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--dump") == 0)
+			dumpDirectory = argv[++i];
+		else if (std::strcmp(argv[i], "--section") == 0)
+			firstSection = argv[++i];
+		else if (std::strcmp(argv[i], "--seed") == 0)
+			randomSeed = argv[++i];
+	}
+
 	AppMain appMain;
 	appMain_ = &appMain;
-	appMain.initialize();
+	if (randomSeed)
+		appMain.setRandomSeed(std::strtoul(randomSeed, NULL, 0));
+	if (headlessFrames > 0) {
+		if (!kuto::GraphicsDevice::instance().initializeHeadless(320, SCREEN_HEIGHT, update))
+			return EXIT_FAILURE;
+		appMain.initialize(firstSection);
+		return kuto::GraphicsDevice::instance().runHeadless(headlessFrames, dumpDirectory)? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	appMain.initialize(firstSection);
 	kuto::GraphicsDevice::instance().initialize(argc, argv, 320, SCREEN_HEIGHT, "RPG Tukuru", update);
 
 	glutMainLoop();
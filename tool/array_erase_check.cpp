@@ -0,0 +1,71 @@
+/*
+ * checks that erased rows and elements are not reached from the direct index.
+ * prints "ok" and exits with EXIT_SUCCESS if nothing is wrong.
+
+	$CXX -Wall -DRPG2K_DEBUG=1 -I../rpg2kLib \
+		array_erase_check.cpp \
+		../rpg2kLib/rpg2k/FileToCompile.cpp \
+		../rpg2kLib/rpg2k/define/*.cpp
+ */
+
+
+#include <cstdlib>
+#include <iostream>
+#include <rpg2kLib.hpp>
+
+using rpg2k::structure::Array1D;
+using rpg2k::structure::Array2D;
+
+
+namespace
+{
+	int failed = 0;
+
+	void check(bool const result, char const* const what)
+	{
+		if(!result) {
+			std::cout << "failed: " << what << std::endl;
+			failed++;
+		}
+	}
+} // namespace
+
+int main()
+{
+	rpg2k::model::SaveData lsd;
+	Array2D& pict = lsd.picture();
+
+// erase a row from an iterator and index it again
+	pict[1][1] = rpg2k::RPG2kString("erased");
+	pict[1].substantiate();
+	pict.erase( pict.find(1) );
+	check( !pict.exists(1), "Array2D::erase(iterator) keeps the row" );
+	check( !pict[1].exists(1), "Array2D::erase(iterator) leaves the old row in the index" );
+
+// erase a row from the index
+	pict[2][1] = rpg2k::RPG2kString("erased");
+	pict[2].substantiate();
+	check( pict.erase(2) == 1, "Array2D::erase(index) erases nothing" );
+	check( !pict.exists(2), "Array2D::erase(index) keeps the row" );
+	check( !pict[2].exists(1), "Array2D::erase(index) leaves the old row in the index" );
+
+// erase a range of rows
+	pict[3][1] = rpg2k::RPG2kString("erased");
+	pict[4][1] = rpg2k::RPG2kString("erased");
+	pict.erase( pict.find(3), pict.end() );
+	check( !pict[3].exists(1) && !pict[4].exists(1), "Array2D::erase(first, last) leaves the old rows in the index" );
+
+// same for Array1D
+	Array1D& row = pict[5];
+	row[2] = 10.0;
+	row.erase( row.find(2) );
+	check( !row.exists(2), "Array1D::erase(iterator) keeps the element" );
+	check( row[2].to<double>() == 160.0, "Array1D::erase(iterator) leaves the old element in the index" );
+
+	row[3] = 10.0;
+	check( row.erase(3) == 1, "Array1D::erase(index) erases nothing" );
+	check( row[3].to<double>() == 120.0, "Array1D::erase(index) leaves the old element in the index" );
+
+	if(failed == 0) std::cout << "ok" << std::endl;
+	return (failed == 0)? EXIT_SUCCESS : EXIT_FAILURE;
+}